@@ -0,0 +1,111 @@
+// bench/bench_bitboard.cpp
+// Host micro-benchmark: distance rings by per-cell queue BFS against the
+// shift-and-mask bitboard flood fill (game/bitboard.h), on the one-word 8x7
+// game grid and on multi-word boards up to 128x128, with a check that both
+// give the same distance for every cell
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_bitboard.cpp src/game/maze_grid.cpp host/*.cpp host/*.c -o /tmp/bench_bitboard && /tmp/bench_bitboard
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "game/maze_generator.h"
+
+// Queue BFS over WallGrid::openings(), one cell at a time
+static uint32_t queueBfs(const WallGrid& g, uint32_t source, uint32_t* dist, uint32_t* queue) {
+    uint32_t cells = g.cellCount();
+    for (uint32_t i = 0; i < cells; i++) dist[i] = UINT32_MAX;
+    const int32_t step[4] = { -(int32_t)g.getWidth(), 1, (int32_t)g.getWidth(), -1 };
+    uint32_t head = 0, tail = 0, far = 0;
+    dist[source] = 0;
+    queue[tail++] = source;
+    while (head < tail) {
+        uint32_t cell = queue[head++];
+        uint8_t open = g.openings(cell % g.getWidth(), cell / g.getWidth());
+        for (uint8_t d = 0; d < 4; d++) {
+            if (!(open & (1 << d))) continue;
+            uint32_t next = cell + step[d];
+            if (dist[next] != UINT32_MAX) continue;
+            dist[next] = far = dist[cell] + 1;
+            queue[tail++] = next;
+        }
+    }
+    return far + 1;
+}
+
+template <uint16_t W, uint16_t H>
+static bool run(const char* label, bool open_grid, int runs) {
+    typedef BitBoard<W, H> Board;
+    std::vector<uint8_t> bits(MAZE_GRID_BYTES(W, H));
+    std::vector<uint16_t> scratch((MAZE_SCRATCH_BYTES(W, H) + 1) / 2);
+    WallGrid grid(bits.data(), W, H);
+    if (open_grid) {
+        // Every in-bounds side open, like the memoryless game
+        grid.clear();
+        for (uint16_t y = 0; y < H; y++) {
+            for (uint16_t x = 0; x < W; x++) {
+                if (x + 1 < W) grid.carve(x, y, EAST);
+                if (y + 1 < H) grid.carve(x, y, SOUTH);
+            }
+        }
+    } else {
+        MAZE_ALGORITHMS[MAZE_ALGO_BACKTRACKER].generate(grid, 42, (uint8_t*)scratch.data());
+    }
+
+    static Board open[4];
+    loadPassages(grid, open);
+    std::vector<uint32_t> dist(Board::CELLS), queue(Board::CELLS);
+
+    // Same distances from a few sources
+    bool same = true;
+    std::vector<Board> rings(Board::CELLS);
+    for (uint32_t source : { 0u, Board::CELLS / 2, Board::CELLS - 1 }) {
+        uint32_t n = queueBfs(grid, source, dist.data(), queue.data());
+        uint32_t m = floodFill(open, Board::cell(source), (Board*)nullptr, rings.data(), Board::CELLS);
+        same &= (n == m);
+        for (uint32_t d = 0; d < m && same; d++) {
+            for (uint32_t i = 0; i < Board::CELLS; i++) {
+                if (rings[d].test(i) != (dist[i] == d)) same = false;
+            }
+        }
+    }
+
+    uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < runs; r++) sink += queueBfs(grid, (r * 7919u) % Board::CELLS, dist.data(), queue.data());
+    double bfs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    Board reached;
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < runs; r++) {
+        sink += floodFill(open, Board::cell((r * 7919u) % Board::CELLS), &reached, rings.data(), Board::CELLS);
+    }
+    double flood = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // Reachability only: no ring copies
+    t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < runs; r++) sink += floodFill(open, Board::cell((r * 7919u) % Board::CELLS), &reached);
+    double reach = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if (sink == 0) printf("!");
+
+    char dims[16];
+    snprintf(dims, sizeof(dims), "%ux%u", W, H);
+    printf("%-11s %-8s %6u %10.2f %10.2f %10.2f %8.1fx %s\n", label, dims, (unsigned)Board::WORDS,
+           bfs * 1e6 / runs, flood * 1e6 / runs, reach * 1e6 / runs, bfs / flood, same ? "same" : "DIFFERENT");
+    return same;
+}
+
+int main() {
+    printf("%-11s %-8s %6s %10s %10s %10s %9s\n", "maze", "grid", "words", "BFS us", "rings us", "reach us", "speedup");
+    bool ok = true;
+    ok &= run<MAZE_WIDTH, MAZE_HEIGHT>("open", true, 500000);
+    ok &= run<MAZE_WIDTH, MAZE_HEIGHT>("perfect", false, 500000);
+    ok &= run<16, 16>("open", true, 100000);
+    ok &= run<16, 16>("perfect", false, 20000);
+    ok &= run<32, 32>("open", true, 20000);
+    ok &= run<32, 32>("perfect", false, 1000);
+    ok &= run<128, 128>("open", true, 200);
+    ok &= run<128, 128>("perfect", false, 5);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// bench/bench_goal_heat.cpp
+// Host benchmark for the goal heat map: the old per-frame Manhattan distance
+// against GoalDistances (field rebuilt when the goal moves, one entry per
+// move, a lookup per frame). Checks every cached distance against a plain
+// BFS and counts how often the two metrics pick a different tint.
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix bench/bench_goal_heat.cpp
+//       src/game/placement.cpp src/game/maze_generator.cpp src/game/maze_grid.cpp
+//       host/*.cpp host/*.c -o /tmp/bench_goal_heat && /tmp/bench_goal_heat
+#include <chrono>
+#include "config.h"
+#include "game/placement.h"
+
+static const int MOVES = 200000;
+static const int FRAMES_PER_MOVE = 30;     // ~0.5 s between moves at 60 FPS
+static const int8_t OFFSET[4] = { -MAZE_WIDTH, 1, MAZE_WIDTH, -1 };
+
+// Same bands as GameState::getGoalColorForDistance
+static uint8_t band(uint8_t d) {
+    return d <= 1 ? d : d <= 4 ? 2 : d <= 9 ? 3 : 4;
+}
+
+// Reference: queue BFS from the player's exits over the passages. The start
+// cell is not marked: coming back into it later uses its passages (memoryless
+// exits are re-rolled on entry)
+static uint8_t referenceDistance(const MazeGenerator& maze, uint8_t cell, uint8_t exits, uint8_t goal) {
+    if (cell == goal) return 0;
+    uint8_t dist[MAZE_CELLS];
+    uint8_t queue[MAZE_CELLS];
+    memset(dist, PLACE_UNREACHABLE, sizeof(dist));
+    uint8_t head = 0, tail = 0;
+    for (uint8_t d = 0; d < 4; d++) {
+        if (!(exits & (1 << d)) || !MAZE_CAN_STEP[d].test(cell)) continue;
+        uint8_t n = cell + OFFSET[d];
+        if (dist[n] == PLACE_UNREACHABLE) { dist[n] = 1; queue[tail++] = n; }
+    }
+    while (head < tail) {
+        uint8_t c = queue[head++];
+        if (c == goal) return dist[c];
+        uint8_t open = maze.getPassages(c % MAZE_WIDTH, c / MAZE_WIDTH);
+        for (uint8_t d = 0; d < 4; d++) {
+            if (!(open & (1 << d))) continue;
+            uint8_t n = c + OFFSET[d];
+            if (dist[n] == PLACE_UNREACHABLE) { dist[n] = dist[c] + 1; queue[tail++] = n; }
+        }
+    }
+    return PLACE_UNREACHABLE;
+}
+
+static double since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main() {
+    MazeGenerator maze;
+    maze.init();
+    GoalDistances heat;
+
+    printf("%-12s %10s %10s %10s %10s %9s %6s\n", "maze", "frame old", "frame new", "move new",
+           "rebuild", "tint diff", "bad");
+    for (int persistent = 0; persistent < 2; persistent++) {
+        maze.setPersistent(persistent);
+        srand(1);
+        double old_frame = 0, new_frame = 0, new_move = 0, rebuild = 0;
+        uint32_t rebuilds = 0, diff = 0, bad = 0;
+        volatile uint32_t sink = 0;
+
+        for (int i = 0; i < MOVES; i++) {
+            // Every 8th move reaches the goal and it moves away
+            if (i % 8 == 0) maze.setGoal(random(0, MAZE_WIDTH), random(0, MAZE_HEIGHT));
+            uint8_t px = random(0, MAZE_WIDTH), py = random(0, MAZE_HEIGHT);
+            maze.generateNewDirections(px, py, 0);
+            uint8_t exits = maze.getCurrentDirections();
+            uint8_t gx = maze.getGoalX(), gy = maze.getGoalY();
+
+            auto t0 = std::chrono::steady_clock::now();
+            bool rebuilt = heat.refresh(maze);
+            double t = since(t0);
+            if (rebuilt) { rebuild += t; rebuilds++; }
+
+            t0 = std::chrono::steady_clock::now();
+            heat.updatePlayer(0, px, py, exits);
+            new_move += since(t0);
+
+            t0 = std::chrono::steady_clock::now();
+            for (int f = 0; f < FRAMES_PER_MOVE; f++) {
+                sink += abs((int)px - (int)gx) + abs((int)py - (int)gy);
+            }
+            old_frame += since(t0);
+
+            t0 = std::chrono::steady_clock::now();
+            for (int f = 0; f < FRAMES_PER_MOVE; f++) {
+                heat.refresh(maze);
+                sink += heat.getPlayerDistance(0);
+            }
+            new_frame += since(t0);
+
+            uint8_t path = heat.getPlayerDistance(0);
+            uint8_t manhattan = abs((int)px - (int)gx) + abs((int)py - (int)gy);
+            uint8_t goal = gy * MAZE_WIDTH + gx;
+            if (path != referenceDistance(maze, py * MAZE_WIDTH + px, exits, goal)) bad++;
+            if (band(path) != band(manhattan)) diff++;
+        }
+        printf("%-12s %7.1f ns %7.1f ns %7.1f ns %7.0f ns %8.1f%% %6u\n",
+               persistent ? "persistent" : "memoryless",
+               old_frame / ((double)MOVES * FRAMES_PER_MOVE), new_frame / ((double)MOVES * FRAMES_PER_MOVE),
+               new_move / MOVES, rebuild / (rebuilds ? rebuilds : 1), 100.0 * diff / MOVES, bad);
+    }
+    printf("frame = tint distance per frame; move = per move; rebuild = flood fill when the goal moves\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+// bench/bench_maze.cpp
+// Host benchmark for per-cell exit generation: the old random()-driven
+// rejection loop against the counter-based hash in MazeGenerator, plus a
+// reproducibility check and the exit-count distribution of both
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix bench/bench_maze.cpp
+//       src/game/maze_generator.cpp src/game/maze_grid.cpp host/*.cpp host/*.c
+//       -o /tmp/bench_maze && /tmp/bench_maze
+#include <chrono>
+#include "config.h"
+#include "game/maze_generator.h"
+
+static const int CELLS = 5000000;
+
+// generateNewDirections() as it was before the hash: 1-3 exits, up to 10
+// random() draws to find them. (Host random() is glibc's, not newlib's.)
+static bool legacyOutOfBounds(uint8_t x, uint8_t y, uint8_t dir) {
+    switch (dir) {
+        case NORTH: return y == 0;
+        case SOUTH: return y >= MAZE_HEIGHT - 1;
+        case EAST:  return x >= MAZE_WIDTH - 1;
+        case WEST:  return x == 0;
+        default:    return true;
+    }
+}
+
+static uint8_t legacyDirections(uint8_t x, uint8_t y) {
+    uint8_t dirs = 0;
+    uint8_t num_exits = 1 + (random() % 3);
+    int attempts = 0;
+    int added = 0;
+    while (added < num_exits && attempts < 10) {
+        uint8_t dir = random() % 4;
+        if (!legacyOutOfBounds(x, y, dir) && !(dirs & (1 << dir))) {
+            dirs |= (1 << dir);
+            added++;
+        }
+        attempts++;
+    }
+    if (dirs == 0) {
+        for (uint8_t d = 0; d < 4; d++) {
+            if (!legacyOutOfBounds(x, y, d)) {
+                dirs |= (1 << d);
+                break;
+            }
+        }
+    }
+    return dirs;
+}
+
+static MazeGenerator maze;
+
+template <typename F>
+static double run(F generate, uint32_t* histogram) {
+    uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < CELLS; i++) {
+        uint8_t x = i % MAZE_WIDTH;
+        uint8_t y = (i / MAZE_WIDTH) % MAZE_HEIGHT;
+        uint8_t dirs = generate(x, y, i);
+        histogram[__builtin_popcount(dirs)]++;
+        sink += dirs;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    if (sink == 0) printf("!");
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+static void report(const char* name, double seconds, const uint32_t* histogram) {
+    printf("%-22s %8.1f ns/cell %10.0f cells/ms   exits 1/2/3/4: %4.1f%% %4.1f%% %4.1f%% %4.1f%%\n",
+           name, seconds * 1e9 / CELLS, CELLS / (seconds * 1e3),
+           100.0 * histogram[1] / CELLS, 100.0 * histogram[2] / CELLS,
+           100.0 * histogram[3] / CELLS, 100.0 * histogram[4] / CELLS);
+}
+
+int main() {
+    // Same seed and the same visits must give the same exits; streams differ
+    MazeGenerator a, b;
+    a.setSeed(1234);
+    b.setSeed(1234);
+    bool same = true, streams_differ = false, never_empty = true;
+    for (int i = 0; i < 10000; i++) {
+        uint8_t x = (i * 7) % MAZE_WIDTH, y = (i * 3) % MAZE_HEIGHT;
+        a.generateNewDirections(x, y, i & 1);
+        b.generateNewDirections(x, y, i & 1);
+        same &= a.getCurrentDirections() == b.getCurrentDirections();
+        never_empty &= a.getCurrentDirections() != 0;
+        streams_differ |= a.directionsFor(x, y, 0, i) != a.directionsFor(x, y, 1, i);
+    }
+    bool ok = same && streams_differ && never_empty;
+    printf("reproducible: %s, per-player streams differ: %s, never walled in: %s\n\n",
+           same ? "yes" : "NO", streams_differ ? "yes" : "NO", never_empty ? "yes" : "NO");
+
+    uint32_t legacy_hist[5] = {0}, hash_hist[5] = {0}, visit_hist[5] = {0};
+    srand(1);
+    double legacy = run([](uint8_t x, uint8_t y, int) { return legacyDirections(x, y); }, legacy_hist);
+    maze.setSeed(1);
+    double hashed = run([](uint8_t x, uint8_t y, int i) {
+        return maze.directionsFor(x, y, i & 1, (uint16_t)(i >> 1));
+    }, hash_hist);
+    double visited = run([](uint8_t x, uint8_t y, int i) {
+        maze.generateNewDirections(x, y, i & 1);
+        return maze.getCurrentDirections();
+    }, visit_hist);
+
+    report("random() + rejection", legacy, legacy_hist);
+    report("hash (directionsFor)", hashed, hash_hist);
+    report("hash + visit counter", visited, visit_hist);
+    printf("speedup: %.1fx\n", legacy / visited);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+// bench/bench_maze_grid.cpp
+// Host benchmark for the persistent-maze algorithms (game/maze_grid.h):
+// generation time and memory per algorithm from the 8x7 game grid up to
+// 256x256, with a check that every result is a perfect maze. Also times
+// the row-at-a-time MazeStream (Eller's) and checks its rows the same way.
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_maze_grid.cpp src/game/maze_grid.cpp src/game/maze_stream.cpp host/*.cpp host/*.c -o /tmp/bench_maze_grid && /tmp/bench_maze_grid
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "game/maze_generator.h"
+#include "game/maze_stream.h"
+
+struct Size { uint16_t w, h; int runs; };
+static const Size SIZES[] = { { MAZE_WIDTH, MAZE_HEIGHT, 20000 }, { 32, 32, 500 }, { 128, 128, 20 }, { 256, 256, 5 } };
+
+// Perfect maze: cells - 1 passages and every cell reachable from (0, 0)
+static bool isPerfect(const WallGrid& g) {
+    uint32_t cells = g.cellCount();
+    uint32_t passages = 0;
+    for (uint16_t y = 0; y < g.getHeight(); y++) {
+        for (uint16_t x = 0; x < g.getWidth(); x++) {
+            passages += __builtin_popcount(g.openings(x, y) & ((1 << EAST) | (1 << SOUTH)));
+        }
+    }
+    std::vector<uint8_t> seen(cells, 0);
+    std::vector<uint32_t> queue(1, 0);
+    seen[0] = 1;
+    for (size_t head = 0; head < queue.size(); head++) {
+        uint16_t x = queue[head] % g.getWidth(), y = queue[head] / g.getWidth();
+        uint8_t open = g.openings(x, y);
+        uint32_t next[4] = { queue[head] - g.getWidth(), queue[head] + 1,
+                             queue[head] + g.getWidth(), queue[head] - 1 };
+        for (uint8_t d = 0; d < 4; d++) {
+            if ((open >> d & 1) && !seen[next[d]]) {
+                seen[next[d]] = 1;
+                queue.push_back(next[d]);
+            }
+        }
+    }
+    return passages == cells - 1 && queue.size() == cells;
+}
+
+static uint32_t deadEnds(const WallGrid& g) {
+    uint32_t n = 0;
+    for (uint16_t y = 0; y < g.getHeight(); y++) {
+        for (uint16_t x = 0; x < g.getWidth(); x++) {
+            n += __builtin_popcount(g.openings(x, y)) == 1;
+        }
+    }
+    return n;
+}
+
+int main() {
+    bool ok = true;
+    printf("%-12s %9s %12s %10s %10s %10s %9s\n",
+           "algorithm", "grid", "us/maze", "ns/cell", "walls B", "scratch B", "dead ends");
+    for (const Size& s : SIZES) {
+        std::vector<uint8_t> bits(MAZE_GRID_BYTES(s.w, s.h));
+        std::vector<uint16_t> scratch((MAZE_SCRATCH_BYTES(s.w, s.h) + 1) / 2);
+        WallGrid grid(bits.data(), s.w, s.h);
+
+        for (uint8_t id = 0; id < MAZE_ALGO_COUNT; id++) {
+            const MazeAlgorithm& algo = MAZE_ALGORITHMS[id];
+            bool perfect = true;
+            uint32_t dead = 0;
+            auto t0 = std::chrono::steady_clock::now();
+            for (int run = 0; run < s.runs; run++) {
+                if (!algo.generate(grid, run + 1, (uint8_t*)scratch.data())) perfect = false;
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            for (int run = 0; run < 3; run++) {
+                algo.generate(grid, 1000 + run, (uint8_t*)scratch.data());
+                perfect &= isPerfect(grid);
+                dead += deadEnds(grid);
+            }
+            ok &= perfect;
+
+            char dims[16];
+            snprintf(dims, sizeof(dims), "%ux%u", s.w, s.h);
+            printf("%-12s %9s %12.1f %10.1f %10u %10u %8.1f%%%s\n", algo.name, dims,
+                   seconds * 1e6 / s.runs, seconds * 1e9 / s.runs / grid.cellCount(),
+                   grid.storageBytes(), algo.scratchBytes(s.w, s.h),
+                   100.0 * dead / 3 / grid.cellCount(), perfect ? "" : "  NOT PERFECT");
+        }
+    }
+
+    // Streaming: rows copied into a full grid only to check them; the stream
+    // itself keeps one row of set labels
+    printf("\n%-12s %9s %12s %10s %10s\n", "stream", "width", "us/row", "ns/cell", "state B");
+    static const uint16_t WIDTHS[] = { MAZE_WIDTH, 15, 32, MAZE_STREAM_MAX_WIDTH };
+    for (uint16_t w : WIDTHS) {
+        const uint32_t rows = 200000;
+        MazeStream stream;
+        stream.init(w, 7);
+        uint32_t sink = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t r = 0; r < rows; r++) sink += stream.nextRow()[0];
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (sink == 0) printf("!");
+
+        bool perfect = true;
+        for (uint16_t h : { 1, 7, 64, 256 }) {
+            std::vector<uint8_t> bits(MAZE_GRID_BYTES(w, h));
+            WallGrid grid(bits.data(), w, h);
+            grid.clear();
+            stream.init(w, 1000 + h);
+            for (uint16_t y = 0; y < h; y++) {
+                const uint8_t* row = stream.nextRow(y == h - 1);
+                for (uint16_t x = 0; x < w; x++) {
+                    uint8_t cell = (row[x >> 2] >> ((x & 3) * 2)) & 0x03;
+                    if (cell & MAZE_PASSAGE_EAST) grid.carve(x, y, EAST);
+                    if (cell & MAZE_PASSAGE_SOUTH) grid.carve(x, y, SOUTH);
+                }
+            }
+            perfect &= isPerfect(grid);
+        }
+        ok &= perfect;
+        printf("%-12s %9u %12.3f %10.1f %10u%s\n", "eller", w, seconds * 1e6 / rows,
+               seconds * 1e9 / rows / w, (unsigned)sizeof(MazeStream), perfect ? "" : "  NOT PERFECT");
+    }
+    return ok ? 0 : 1;
+}
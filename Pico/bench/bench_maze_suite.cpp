@@ -0,0 +1,384 @@
+// bench/bench_maze_suite.cpp
+// Host benchmark and quality suite for every maze generator mode, emitted as
+// CSV (default) or JSON so generator changes can be diffed run to run:
+//   memoryless   MazeGenerator::generateNewDirections (per-visit exits, 8x7)
+//   backtracker / wilson / kruskal   MAZE_ALGORITHMS on a WallGrid
+//   eller        MazeStream, row by row
+//   world        MazeWorld chunks (default algorithm), read cell by cell
+// Each mode runs over millions of cells and thousands of seeds and reports:
+//   cells_per_sec   generation throughput (stats are gathered outside the timing)
+//   memory_bytes    working memory of the mode (grid + scratch, visit counters,
+//                   stream state or the chunk cache)
+//   exits_0..4      share of cells with that many exits; dead_end_ratio = exits_1
+//   perfect_pct     mazes with exactly one path between any two cells
+//   path_len        mean shortest path (0,0) -> far corner, in moves
+//   walk_moves      mean moves of a random walker from (0,0) to the far corner
+//                   (8x7 only; memoryless exits re-roll on entry, as in the game)
+//   reproducible    the same seed twice gives identical output
+//   unique_pct      distinct outputs across seeds
+// Quantities a mode does not have are empty (CSV) / null (JSON).
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_maze_suite.cpp src/game/maze_generator.cpp src/game/maze_grid.cpp
+//       src/game/maze_stream.cpp src/game/maze_world.cpp host/*.cpp host/*.c -o /tmp/bench_maze_suite
+//   /tmp/bench_maze_suite [--json] [--cells N]    (N = cells per row, default 4000000)
+#include <chrono>
+#include <cmath>
+#include <set>
+#include <string>
+#include <vector>
+#include "config.h"
+#include "game/maze_generator.h"
+#include "game/maze_stream.h"
+#include "game/maze_world.h"
+
+static const uint32_t WALK_SEEDS = 2000;          // Random walks per 8x7 row
+static const uint32_t WALK_CAP = 1000000;         // Moves before a walk gives up
+static const uint32_t MAX_SEEDS = 100000;
+
+struct Result {
+    std::string mode;
+    uint16_t w, h;
+    uint32_t seeds;
+    uint64_t cells;
+    double cells_per_sec;
+    uint32_t memory_bytes;
+    uint64_t exits[5];
+    double perfect_pct;        // < 0 = n/a
+    double path_len;
+    double walk_moves;
+    bool reproducible;
+    double unique_pct;
+
+    Result(const char* m, uint16_t w_, uint16_t h_)
+        : mode(m), w(w_), h(h_), seeds(0), cells(0), cells_per_sec(0), memory_bytes(0), exits{},
+          perfect_pct(-1), path_len(-1), walk_moves(-1), reproducible(false), unique_pct(0) {}
+};
+
+// FNV-1a, for output fingerprints
+static uint64_t fnv(uint64_t h, const uint8_t* p, size_t n) {
+    if (h == 0) h = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < n; i++) h = (h ^ p[i]) * 0x100000001B3ULL;
+    return h;
+}
+
+static double since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// ---------------------------------------------------------------------------
+// Grid statistics shared by the carved modes
+
+struct GridStats {
+    std::vector<uint32_t> dist;
+    std::vector<uint32_t> queue;
+};
+
+// Exit histogram into r, returns whether the maze is perfect and the
+// shortest path to the far corner (UINT32_MAX if unreachable)
+static bool gridStats(const WallGrid& g, Result& r, GridStats& s, uint32_t* path) {
+    uint32_t w = g.getWidth(), cells = g.cellCount();
+    uint32_t passages = 0;
+    for (uint32_t i = 0; i < cells; i++) {
+        uint8_t open = g.openings(i % w, i / w);
+        r.exits[__builtin_popcount(open)]++;
+        passages += __builtin_popcount(open & ((1 << EAST) | (1 << SOUTH)));
+    }
+
+    s.dist.assign(cells, UINT32_MAX);
+    s.queue.clear();
+    s.dist[0] = 0;
+    s.queue.push_back(0);
+    for (size_t head = 0; head < s.queue.size(); head++) {
+        uint32_t c = s.queue[head];
+        uint8_t open = g.openings(c % w, c / w);
+        uint32_t next[4] = { c - w, c + 1, c + w, c - 1 };
+        for (uint8_t d = 0; d < 4; d++) {
+            if ((open >> d & 1) && s.dist[next[d]] == UINT32_MAX) {
+                s.dist[next[d]] = s.dist[c] + 1;
+                s.queue.push_back(next[d]);
+            }
+        }
+    }
+    *path = s.dist[cells - 1];
+    return passages == cells - 1 && s.queue.size() == cells;
+}
+
+// Random walk on a fixed grid: uniform among the open sides
+static uint32_t walkGrid(const WallGrid& g, uint32_t seed) {
+    MazeRng rng(seed);
+    uint16_t x = 0, y = 0;
+    uint32_t moves = 0;
+    while ((x != g.getWidth() - 1 || y != g.getHeight() - 1) && moves < WALK_CAP) {
+        uint8_t open = g.openings(x, y);
+        uint8_t pick = rng.below(__builtin_popcount(open));
+        uint8_t d = 0;
+        for (; d < 4; d++) {
+            if ((open >> d & 1) && pick-- == 0) break;
+        }
+        if (d == NORTH) y--; else if (d == SOUTH) y++; else if (d == EAST) x++; else x--;
+        moves++;
+    }
+    return moves;
+}
+
+// Seeds for a row: enough mazes for the cell budget, bounded for tiny grids
+static uint32_t seedsFor(uint64_t cells_budget, uint32_t cells_per_maze) {
+    uint64_t n = cells_budget / cells_per_maze;
+    if (n < 1) n = 1;
+    if (n > MAX_SEEDS) n = MAX_SEEDS;
+    return (uint32_t)n;
+}
+
+// Carved modes: generate(grid, seed) fills the grid and returns the seconds spent
+template <typename Generate>
+static Result runCarved(const char* mode, uint16_t w, uint16_t h, uint32_t memory, uint64_t budget,
+                        Generate generate) {
+    Result r(mode, w, h);
+    r.memory_bytes = memory;
+    r.seeds = seedsFor(budget, (uint32_t)w * h);
+    std::vector<uint8_t> bits(MAZE_GRID_BYTES(w, h));
+    WallGrid grid(bits.data(), w, h);
+    GridStats scratch;
+    std::set<uint64_t> prints;
+    uint32_t perfect = 0, reached = 0;
+    double seconds = 0, path_total = 0, walk_total = 0;
+    uint32_t walks = 0;
+
+    for (uint32_t s = 0; s < r.seeds; s++) {
+        seconds += generate(grid, s + 1);
+        r.cells += grid.cellCount();
+
+        uint32_t path;
+        perfect += gridStats(grid, r, scratch, &path);
+        if (path != UINT32_MAX) {
+            path_total += path;
+            reached++;
+        }
+        if (w == MAZE_WIDTH && h == MAZE_HEIGHT && walks < WALK_SEEDS) {
+            walk_total += walkGrid(grid, s);
+            walks++;
+        }
+        prints.insert(fnv(0, bits.data(), bits.size()));
+    }
+
+    // Same seed again, after other seeds ran
+    generate(grid, 1);
+    uint64_t first = fnv(0, bits.data(), bits.size());
+    generate(grid, 2);
+    generate(grid, 1);
+    uint64_t again = fnv(0, bits.data(), bits.size());
+
+    r.cells_per_sec = r.cells / seconds;
+    r.perfect_pct = 100.0 * perfect / r.seeds;
+    r.path_len = reached ? path_total / reached : -1;
+    r.walk_moves = walks ? walk_total / walks : -1;
+    r.reproducible = first == again;
+    r.unique_pct = 100.0 * prints.size() / r.seeds;
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// Memoryless: every cell visited MEMORYLESS_VISITS times per seed on stream 0
+
+static const uint16_t MEMORYLESS_VISITS = 8;
+
+static uint64_t memorylessPass(MazeGenerator& maze, uint32_t seed, uint8_t* out) {
+    maze.setSeed(seed);
+    uint32_t n = 0;
+    for (uint16_t v = 0; v < MEMORYLESS_VISITS; v++) {
+        for (uint8_t y = 0; y < MAZE_HEIGHT; y++) {
+            for (uint8_t x = 0; x < MAZE_WIDTH; x++) {
+                maze.generateNewDirections(x, y, 0);
+                out[n++] = maze.getCurrentDirections();
+            }
+        }
+    }
+    return fnv(0, out, n);
+}
+
+// The game's own walk: exits re-roll on every entry, the walker takes one
+static uint32_t walkMemoryless(MazeGenerator& maze, uint32_t seed) {
+    MazeRng rng(seed);
+    maze.setSeed(seed);
+    uint8_t x = 0, y = 0;
+    maze.generateNewDirections(x, y, 0);
+    uint32_t moves = 0;
+    while ((x != MAZE_WIDTH - 1 || y != MAZE_HEIGHT - 1) && moves < WALK_CAP) {
+        uint8_t open = maze.getCurrentDirections();
+        uint8_t pick = rng.below(__builtin_popcount(open));
+        uint8_t d = 0;
+        for (; d < 4; d++) {
+            if ((open >> d & 1) && pick-- == 0) break;
+        }
+        if (d == NORTH) y--; else if (d == SOUTH) y++; else if (d == EAST) x++; else x--;
+        maze.generateNewDirections(x, y, 0);
+        moves++;
+    }
+    return moves;
+}
+
+static Result runMemoryless(uint64_t budget) {
+    static MazeGenerator maze;
+    Result r("memoryless", MAZE_WIDTH, MAZE_HEIGHT);
+    const uint32_t per_seed = MAZE_CELLS * MEMORYLESS_VISITS;
+    r.seeds = seedsFor(budget, per_seed);
+    r.memory_bytes = MAZE_STREAMS * MAZE_CELLS * sizeof(uint16_t);   // Visit counters
+    std::vector<uint8_t> out(per_seed);
+    std::set<uint64_t> prints;
+
+    // Throughput: generateNewDirections alone
+    volatile uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t s = 0; s < r.seeds; s++) {
+        maze.setSeed(s + 1);
+        for (uint16_t v = 0; v < MEMORYLESS_VISITS; v++) {
+            for (uint8_t y = 0; y < MAZE_HEIGHT; y++) {
+                for (uint8_t x = 0; x < MAZE_WIDTH; x++) {
+                    maze.generateNewDirections(x, y, 0);
+                    sink += maze.getCurrentDirections();
+                }
+            }
+        }
+    }
+    r.cells_per_sec = (double)r.seeds * per_seed / since(t0);
+    r.cells = (uint64_t)r.seeds * per_seed;
+
+    for (uint32_t s = 0; s < r.seeds; s++) {
+        prints.insert(memorylessPass(maze, s + 1, out.data()));
+        for (uint32_t i = 0; i < per_seed; i++) r.exits[__builtin_popcount(out[i])]++;
+    }
+    double walk_total = 0;
+    for (uint32_t s = 0; s < WALK_SEEDS; s++) walk_total += walkMemoryless(maze, s + 1);
+
+    uint64_t first = memorylessPass(maze, 1, out.data());
+    memorylessPass(maze, 2, out.data());
+    r.reproducible = memorylessPass(maze, 1, out.data()) == first;
+    r.unique_pct = 100.0 * prints.size() / r.seeds;
+    r.walk_moves = walk_total / WALK_SEEDS;
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// Output
+
+static void printValue(double v, bool json) {
+    if (v < 0) printf(json ? "null" : "");
+    else if (v == floor(v) || v >= 1e6) printf("%.0f", v);
+    else if (v >= 100) printf("%.1f", v);
+    else printf("%.4f", v);
+}
+
+static void emit(const std::vector<Result>& rows, bool json) {
+    static const char* FIELDS[] = { "mode", "width", "height", "seeds", "cells", "cells_per_sec",
+                                    "memory_bytes", "exits_0", "exits_1", "exits_2", "exits_3",
+                                    "exits_4", "dead_end_ratio", "perfect_pct", "path_len",
+                                    "walk_moves", "reproducible", "unique_pct" };
+    const size_t n = sizeof(FIELDS) / sizeof(FIELDS[0]);
+    if (json) {
+        printf("[\n");
+    } else {
+        for (size_t i = 0; i < n; i++) printf("%s%s", FIELDS[i], i + 1 < n ? "," : "\n");
+    }
+
+    for (size_t k = 0; k < rows.size(); k++) {
+        const Result& r = rows[k];
+        uint64_t total = 0;
+        for (uint8_t e = 0; e < 5; e++) total += r.exits[e];
+        double values[] = { (double)r.w, (double)r.h, (double)r.seeds, (double)r.cells, r.cells_per_sec,
+                            (double)r.memory_bytes, 0, 0, 0, 0, 0, 0,
+                            r.perfect_pct, r.path_len, r.walk_moves, (double)r.reproducible, r.unique_pct };
+        for (uint8_t e = 0; e < 5; e++) values[6 + e] = (double)r.exits[e] / total;
+        values[11] = values[7];
+
+        if (json) printf("  {\"%s\": \"%s\"", FIELDS[0], r.mode.c_str());
+        else printf("%s", r.mode.c_str());
+        for (size_t i = 1; i < n; i++) {
+            if (json) printf(", \"%s\": ", FIELDS[i]);
+            else printf(",");
+            if (i == 16 && json) printf(r.reproducible ? "true" : "false");
+            else printValue(values[i - 1], json);
+        }
+        if (json) printf("}%s\n", k + 1 < rows.size() ? "," : "");
+        else printf("\n");
+    }
+    if (json) printf("]\n");
+}
+
+int main(int argc, char** argv) {
+    bool json = false;
+    uint64_t budget = 4000000;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--json") json = true;
+        else if (arg == "--cells" && i + 1 < argc) budget = strtoull(argv[++i], nullptr, 10);
+        else {
+            fprintf(stderr, "usage: %s [--json] [--cells N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<Result> rows;
+    rows.push_back(runMemoryless(budget));
+
+    struct Size { uint16_t w, h; };
+    static const Size SIZES[] = { { MAZE_WIDTH, MAZE_HEIGHT }, { 64, 64 }, { 256, 256 } };
+    for (const Size& s : SIZES) {
+        std::vector<uint16_t> scratch((MAZE_SCRATCH_BYTES(s.w, s.h) + 1) / 2);
+        for (uint8_t id = 0; id < MAZE_ALGO_COUNT; id++) {
+            const MazeAlgorithm& algo = MAZE_ALGORITHMS[id];
+            rows.push_back(runCarved(algo.name, s.w, s.h,
+                                     MAZE_GRID_BYTES(s.w, s.h) + algo.scratchBytes(s.w, s.h), budget,
+                                     [&](WallGrid& g, uint32_t seed) {
+                auto t0 = std::chrono::steady_clock::now();
+                algo.generate(g, seed, (uint8_t*)scratch.data());
+                return since(t0);
+            }));
+        }
+
+        // Eller's: rows copied into the grid outside the timing
+        if (s.w <= MAZE_STREAM_MAX_WIDTH) {
+            static MazeStream stream;
+            rows.push_back(runCarved("eller", s.w, s.h, sizeof(MazeStream), budget,
+                                     [&](WallGrid& g, uint32_t seed) {
+                g.clear();
+                stream.init(s.w, seed);
+                double seconds = 0;
+                for (uint16_t y = 0; y < s.h; y++) {
+                    auto t0 = std::chrono::steady_clock::now();
+                    const uint8_t* row = stream.nextRow(y == s.h - 1);
+                    seconds += since(t0);
+                    for (uint16_t x = 0; x < s.w; x++) {
+                        uint8_t cell = (row[x >> 2] >> ((x & 3) * 2)) & 0x03;
+                        if (cell & MAZE_PASSAGE_EAST) g.carve(x, y, EAST);
+                        if (cell & MAZE_PASSAGE_SOUTH) g.carve(x, y, SOUTH);
+                    }
+                }
+                return seconds;
+            }));
+        }
+
+        // Chunked world: every cell read once through the cache
+        if (s.w % MAZE_CHUNK_SIZE == 0 && s.h % MAZE_CHUNK_SIZE == 0) {
+            static MazeWorld world;
+            std::vector<uint8_t> open((uint32_t)s.w * s.h);
+            rows.push_back(runCarved("world", s.w, s.h, sizeof(MazeWorld), budget,
+                                     [&](WallGrid& g, uint32_t seed) {
+                world.init(seed, s.w / MAZE_CHUNK_SIZE, s.h / MAZE_CHUNK_SIZE);
+                auto t0 = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < open.size(); i++) open[i] = world.openings(i % s.w, i / s.w);
+                double seconds = since(t0);
+                g.clear();
+                for (uint32_t i = 0; i < open.size(); i++) {
+                    if (open[i] & (1 << EAST)) g.carve(i % s.w, i / s.w, EAST);
+                    if (open[i] & (1 << SOUTH)) g.carve(i % s.w, i / s.w, SOUTH);
+                }
+                return seconds;
+            }));
+        }
+    }
+
+    emit(rows, json);
+    return 0;
+}
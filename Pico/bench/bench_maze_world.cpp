@@ -0,0 +1,132 @@
+// bench/bench_maze_world.cpp
+// Host benchmark for MazeWorld: checks a small world (with constant eviction)
+// is one perfect maze that reads back the same after chunks are carved again,
+// then roams a 16384 x 16384-cell world - a player walking the passages with
+// an 8x7 viewport read around it every step - and random teleports with the
+// same viewport, reporting cache hits per lookup, chunks carved per step and
+// carve cost per algorithm. The per-lookup hit rate flatters teleports: the
+// other lookups of a viewport hit the chunk its first one just carved, so
+// carves per step is the figure to compare.
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix bench/bench_maze_world.cpp
+//       src/game/maze_world.cpp src/game/maze_grid.cpp host/*.cpp host/*.c
+//       -o /tmp/bench_maze_world && /tmp/bench_maze_world
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "game/maze_world.h"
+#include "game/maze_generator.h"
+
+static const int8_t DX[4] = { 0, 1, 0, -1 };
+static const int8_t DY[4] = { -1, 0, 1, 0 };
+static const uint32_t STEPS = 200000;
+
+// Edges = cells - 1, every cell reached, both sides of each wall agree, and
+// a second read after a full cache turnover matches
+static bool checkPerfect(uint8_t algo) {
+    MazeWorld world;
+    world.init(1234, 8, 6, algo);
+    uint32_t w = world.getWidth(), h = world.getHeight();
+    std::vector<uint8_t> first(w * h);
+    uint32_t edges = 0;
+    for (uint32_t y = 0; y < h; y++) {
+        for (uint32_t x = 0; x < w; x++) {
+            uint8_t d = world.openings(x, y);
+            first[y * w + x] = d;
+            if (d & (1 << EAST)) {
+                edges++;
+                if (!(world.openings(x + 1, y) & (1 << WEST))) return false;
+            }
+            if (d & (1 << SOUTH)) {
+                edges++;
+                if (!(world.openings(x, y + 1) & (1 << NORTH))) return false;
+            }
+        }
+    }
+    std::vector<uint8_t> seen(w * h, 0);
+    std::vector<uint32_t> stack(1, 0);
+    seen[0] = 1;
+    uint32_t reached = 1;
+    while (!stack.empty()) {
+        uint32_t c = stack.back();
+        stack.pop_back();
+        for (uint8_t d = 0; d < 4; d++) {
+            if (!(first[c] & (1 << d))) continue;
+            uint32_t n = (c / w + DY[d]) * w + c % w + DX[d];
+            if (!seen[n]) { seen[n] = 1; reached++; stack.push_back(n); }
+        }
+    }
+    for (uint32_t y = h; y-- > 0;) {                  // Reverse order: every chunk carved again
+        for (uint32_t x = w; x-- > 0;) {
+            if (world.openings(x, y) != first[y * w + x]) return false;
+        }
+    }
+    return edges == w * h - 1 && reached == w * h;
+}
+
+static void roam(uint8_t algo, bool random_access) {
+    MazeWorld world;
+    world.init(99, 1024, 1024, algo);
+    uint32_t x = world.getWidth() / 2, y = world.getHeight() / 2;
+    uint8_t came_from = DIR_NONE;
+    srand(7);
+    uint32_t lookups = 0;
+    volatile uint32_t sink = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t s = 0; s < STEPS; s++) {
+        if (random_access) {
+            x = random(0, world.getWidth());
+            y = random(0, world.getHeight());
+        } else {
+            // Random walk along passages, turning back only at dead ends
+            uint8_t dirs = world.openings(x, y);
+            lookups++;
+            uint8_t options = dirs;
+            if (came_from != DIR_NONE && (options & ~(1 << came_from))) options &= ~(1 << came_from);
+            uint8_t count = __builtin_popcount(options);
+            uint8_t pick = random(0, count);
+            uint8_t d = 0;
+            for (; d < 4; d++) {
+                if ((options & (1 << d)) && pick-- == 0) break;
+            }
+            x += DX[d];
+            y += DY[d];
+            came_from = (d + 2) & 3;
+        }
+        // The viewport: an 8x7 window around the player, clipped to the world
+        for (int32_t vy = (int32_t)y - 3; vy <= (int32_t)y + 3; vy++) {
+            for (int32_t vx = (int32_t)x - 4; vx < (int32_t)x + 4; vx++) {
+                if (vx < 0 || vy < 0) continue;
+                sink += world.openings(vx, vy);
+                lookups++;
+            }
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+
+    uint32_t total = world.getHits() + world.getMisses();
+    printf("%-12s %-7s %10.1f%% %8u %11.3f %10.1f %10.1f %9.1f\n", MAZE_ALGORITHMS[algo].name,
+           random_access ? "random" : "walk", 100.0 * world.getHits() / total, world.getMisses(),
+           (double)world.getMisses() / STEPS,
+           world.getMisses() ? (double)world.getCarveMicros() / world.getMisses() : 0.0,
+           ns / lookups, ns / STEPS / 1000.0);
+}
+
+int main() {
+    printf("world %ux%u cells in %u-cell chunks, %u cached (%u B of walls)\n",
+           1024u << MAZE_CHUNK_SHIFT, 1024u << MAZE_CHUNK_SHIFT, MAZE_CHUNK_SIZE,
+           MAZE_CHUNK_CACHE, (unsigned)(MAZE_CHUNK_CACHE * MAZE_CHUNK_BYTES));
+    for (uint8_t a = 0; a < MAZE_ALGO_COUNT; a++) {
+        printf("%-12s perfect + stable after eviction: %s\n", MAZE_ALGORITHMS[a].name,
+               checkPerfect(a) ? "yes" : "NO");
+    }
+    printf("%-12s %-7s %11s %8s %11s %10s %10s %9s\n", "algorithm", "access", "hits/lookup", "carved",
+           "carves/step", "us/carve", "ns/lookup", "us/step");
+    for (uint8_t a = 0; a < MAZE_ALGO_COUNT; a++) {
+        roam(a, false);
+        roam(a, true);
+    }
+    return 0;
+}
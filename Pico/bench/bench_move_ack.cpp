@@ -0,0 +1,75 @@
+// bench/bench_move_ack.cpp
+// Host benchmark for move acknowledgement latency: time from a decoded move to
+// the point main.cpp writes V/I/G. Three ways: the whole move before the ack
+// (as before), deciding on arrival and finishing after the ack, and committing
+// a plan GameState::prepareMoves() made in idle time.
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix bench/bench_move_ack.cpp
+//       src/game/*.cpp src/sprites/*.cpp src/effects/*.cpp src/display/*.cpp
+//       lib/RP2040Matrix/GFXMatrix.cpp host/*.cpp host/*.c -o /tmp/bench_move_ack && /tmp/bench_move_ack
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "game/game_state.h"
+#include "hub75.h"
+
+static const int MOVES = 100000;
+
+enum AckMode { ACK_AFTER_ALL, ACK_ON_ARRIVAL, ACK_PREPARED };
+
+static void run(GameState& game, AckMode mode, bool persistent, std::vector<double>& ns, uint32_t* hits) {
+    game.getMaze().setPersistent(persistent);
+    game.setSpeculation(mode == ACK_PREPARED);
+    game.init();
+    game.handleInput(NORTH);           // Start screen -> new round
+    game.finishMove();
+    srand(1);
+    *hits = 0;
+
+    for (int i = 0; i < MOVES; i++) {
+        // Idle frame time before the next move comes in
+        game.update();
+        game.prepareMoves();
+        hostAdvanceMicros(FRAME_INTERVAL_US);
+
+        Direction dir = (Direction)random(0, 4);
+        auto t0 = std::chrono::steady_clock::now();
+        game.handleInput(dir);
+        if (mode == ACK_AFTER_ALL) game.finishMove();
+        MoveResult res = game.getLastMoveResult();
+        ns.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count());
+        (void)res;
+        game.finishMove();
+        *hits += game.wasMovePrepared();
+
+        // Leave the goal message / win screens as the game would
+        for (int f = 0; f < 3; f++) game.update();
+        hostAdvanceMicros(2100000);
+        game.update();
+    }
+}
+
+static void report(const char* maze, const char* mode, std::vector<double>& ns, uint32_t hits) {
+    double total = 0;
+    for (double v : ns) total += v;
+    std::sort(ns.begin(), ns.end());
+    printf("%-12s %-18s %8.0f ns avg %8.0f ns p99.9   prepared %5.1f%%\n", maze, mode,
+           total / ns.size(), ns[ns.size() * 999 / 1000], 100.0 * hits / ns.size());
+}
+
+int main() {
+    static GameState game;
+    static const char* MODES[] = { "move, then ack", "decide, ack", "prepared, ack" };
+    for (int persistent = 0; persistent < 2; persistent++) {
+        for (int mode = 0; mode < 3; mode++) {
+            std::vector<double> ns;
+            ns.reserve(MOVES);
+            uint32_t hits;
+            run(game, (AckMode)mode, persistent, ns, &hits);
+            report(persistent ? "persistent" : "memoryless", MODES[mode], ns, hits);
+        }
+    }
+    return 0;
+}
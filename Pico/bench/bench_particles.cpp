@@ -0,0 +1,56 @@
+// bench/bench_particles.cpp
+// Host benchmark for ParticleSystem: update + render throughput at several pool sizes
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_particles.cpp src/effects/particle_system.cpp src/display/display_manager.cpp
+//       lib/RP2040Matrix/GFXMatrix.cpp host/*.cpp host/*.c -o /tmp/bench_particles && /tmp/bench_particles
+#include <chrono>
+#include "effects/particle_system.h"
+
+static const int FRAMES = 20000;
+
+static ParticleSystem particles;
+static DisplayManager display;
+
+// Keep the pool topped up to `target` live particles with a mix of all emitters
+static void refill(uint16_t target) {
+    while (particles.getActiveCount() + 16 <= target) {
+        particles.emitBurst(32, 32, 8, 0x07E0);
+        particles.emitSparks(32, 40, 4);
+        particles.emitConfetti(0, 64, 4);
+    }
+}
+
+int main() {
+    display.init();
+
+    printf("%8s %12s %12s %14s\n", "live", "update us", "render us", "particles/ms");
+    const uint16_t targets[] = {32, 64, 128, 192, 256};
+    for (uint16_t target : targets) {
+        if (target > PARTICLE_CAPACITY) break;
+
+        particles.clear();
+        double update_s = 0, render_s = 0;
+        uint64_t processed = 0;
+
+        for (int f = 0; f < FRAMES; f++) {
+            refill(target);
+            processed += particles.getActiveCount();
+
+            auto t0 = std::chrono::steady_clock::now();
+            particles.update();
+            auto t1 = std::chrono::steady_clock::now();
+            particles.render(&display);
+            auto t2 = std::chrono::steady_clock::now();
+
+            update_s += std::chrono::duration<double>(t1 - t0).count();
+            render_s += std::chrono::duration<double>(t2 - t1).count();
+        }
+
+        double per_ms = processed / ((update_s + render_s) * 1e3);
+        printf("%8u %12.3f %12.3f %14.0f\n", target,
+               update_s * 1e6 / FRAMES, render_s * 1e6 / FRAMES, per_ms);
+    }
+    return 0;
+}
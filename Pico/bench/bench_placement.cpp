@@ -0,0 +1,98 @@
+// bench/bench_placement.cpp
+// Host benchmark for goal placement: the old rejection loop (random cells,
+// Euclidean distance, up to 1000 tries) against DistanceField's flood fill +
+// O(1) pick, average and worst case, in memoryless and persistent mazes
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_placement.cpp src/game/placement.cpp src/game/maze_generator.cpp
+//       src/game/maze_grid.cpp host/*.cpp host/*.c -o /tmp/bench_placement && /tmp/bench_placement
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "config.h"
+#include "game/placement.h"
+
+static const int PLACEMENTS = 200000;
+
+struct Timing {
+    std::vector<double> ns;
+    uint32_t misses = 0;     // Placed closer than asked (old: loop timed out)
+    uint32_t bad = 0;        // Unreachable, or short although a farther cell existed
+
+    void add(double t) { ns.push_back(t); }
+};
+
+// relocateGoal() as it was: Euclidean distance >= 7 from both players
+static void legacyGoal(uint8_t p1x, uint8_t p1y, uint8_t p2x, uint8_t p2y, uint8_t* gx, uint8_t* gy, bool* timed_out) {
+    int dist_sq1, dist_sq2;
+    int goal_attempts = 0;
+    *timed_out = false;
+    do {
+        *gx = random(0, MAZE_WIDTH);
+        *gy = random(0, MAZE_HEIGHT);
+        int dx1 = (int)p1x - (int)*gx;
+        int dy1 = (int)p1y - (int)*gy;
+        dist_sq1 = dx1 * dx1 + dy1 * dy1;
+        int dx2 = (int)p2x - (int)*gx;
+        int dy2 = (int)p2y - (int)*gy;
+        dist_sq2 = dx2 * dx2 + dy2 * dy2;
+        goal_attempts++;
+        if (goal_attempts > 1000) {
+            *timed_out = true;
+            break;
+        }
+    } while (dist_sq1 < 49 || dist_sq2 < 49);
+}
+
+// Worst case is reported as the 99.9th percentile: the true maximum of a
+// host run is scheduler noise
+static void report(const char* name, Timing& t) {
+    double total = 0;
+    for (double v : t.ns) total += v;
+    std::sort(t.ns.begin(), t.ns.end());
+    printf("%-27s %7.0f ns avg %8.0f ns p99.9   short: %5.1f%%   bad: %u\n", name,
+           total / t.ns.size(), t.ns[t.ns.size() * 999 / 1000], 100.0 * t.misses / PLACEMENTS, t.bad);
+}
+
+int main() {
+    MazeGenerator maze;
+    maze.init();
+    DistanceField field;
+
+    for (int persistent = 0; persistent < 2; persistent++) {
+        maze.setPersistent(persistent);
+        Timing legacy, bfs;
+        srand(1);
+        for (int i = 0; i < PLACEMENTS; i++) {
+            uint8_t p1x = random(0, MAZE_WIDTH), p1y = random(0, MAZE_HEIGHT);
+            uint8_t p2x = random(0, MAZE_WIDTH), p2y = random(0, MAZE_HEIGHT);
+            uint8_t gx, gy;
+
+            bool timed_out;
+            auto t0 = std::chrono::steady_clock::now();
+            legacyGoal(p1x, p1y, p2x, p2y, &gx, &gy, &timed_out);
+            legacy.add(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count());
+            legacy.misses += timed_out;
+
+            uint8_t sources[2] = { (uint8_t)(p1y * MAZE_WIDTH + p1x), (uint8_t)(p2y * MAZE_WIDTH + p2x) };
+            uint64_t exclude = (1ULL << sources[0]) | (1ULL << sources[1]);
+            t0 = std::chrono::steady_clock::now();
+            field.build(maze, sources, 2, exclude);
+            bool found = field.pick(GOAL_RELOCATE_PATH_DIST, &gx, &gy);
+            bfs.add(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count());
+            if (!found || field.distanceAt(gx, gy) == PLACE_UNREACHABLE) {
+                bfs.bad++;
+            } else if (field.distanceAt(gx, gy) < GOAL_RELOCATE_PATH_DIST) {
+                bfs.misses++;
+                if (field.distanceAt(gx, gy) != field.getMaxDistance()) bfs.bad++;
+            }
+        }
+        printf("%s maze, goal >= 7 from both players:\n", persistent ? "persistent (backtracker)" : "memoryless");
+        report("  rejection (Euclidean)", legacy);
+        report("  flood fill + pick (path)", bfs);
+        printf("  bounds: rejection up to 1001 tries x 4 random(); flood fill <= %d rings + 1 random()\n",
+               MAZE_CELLS);
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+// bench/bench_sprites.cpp
+// Host benchmark for sprite blitting: the old per-pixel RGB565 path
+// (transparent-color compare + drawPixel) against the mask-based blit, served
+// from SpriteCache (warm) or decoded from flash on every draw (cold), and the
+// cost of each flip/rotate transform relative to a plain blit, plus compiled
+// (straight-line, generated) frames against the generic loop, and a
+// z-sorted SpriteBatch with dozens of entities. Every transform is first
+// checked against a per-pixel reference on a block smaller than 8x8.
+//
+// Build & run (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix
+//       bench/bench_sprites.cpp src/sprites/sprite.cpp src/sprites/sprite_cache.cpp src/sprites/sprite_batch.cpp
+//       src/display/display_manager.cpp lib/RP2040Matrix/GFXMatrix.cpp host/*.cpp host/*.c -o /tmp/bench_sprites && /tmp/bench_sprites
+#include <chrono>
+#include <cstring>
+#include "config.h"
+#include "sprites/sprite.h"
+#include "sprites/player_sprites.h"
+#include "sprites/goal_sprites.h"
+#include "sprites/sprite_cache.h"
+#include "sprites/sprite_batch.h"
+
+static const int DRAWS = 200000;
+
+// Player 1 idle frame 0 as it was stored before the sprite pipeline
+#define _T_ 0xF81F
+#define B1  0x5F0B
+#define WH  0xFFFF
+#define BK  0x0000
+static const uint16_t LEGACY_P1_F0[] = {
+    _T_, _T_, B1,  B1,  B1,  B1,  _T_, _T_,
+    _T_, B1,  B1,  WH,  BK,  B1,  B1,  _T_,
+    _T_, B1,  B1,  BK,  BK,  B1,  B1,  _T_,
+    _T_, _T_, B1,  B1,  B1,  B1,  _T_, B1,
+    B1,  B1,  B1,  B1,  B1,  B1,  B1,  B1,
+    B1,  _T_, B1,  B1,  B1,  B1,  _T_, _T_,
+    _T_, _T_, B1,  _T_, _T_, B1,  B1,  _T_,
+    _T_, B1,  B1,  _T_, _T_, _T_, _T_, _T_,
+};
+
+static DisplayManager display;
+static SpriteInstance player;
+static SpriteInstance goal;
+
+static void legacyDraw(int16_t x, int16_t y) {
+    for (uint8_t py = 0; py < 8; py++) {
+        for (uint8_t px = 0; px < 8; px++) {
+            uint16_t color = pgm_read_word(&LEGACY_P1_F0[py * 8 + px]);
+            if (color != _T_) display.drawPixel(x + px, y + py, color);
+        }
+    }
+}
+
+static void legacyTint(int16_t x, int16_t y, uint16_t tint) {
+    for (uint8_t py = 0; py < 8; py++) {
+        for (uint8_t px = 0; px < 8; px++) {
+            if (pgm_read_word(&LEGACY_P1_F0[py * 8 + px]) != _T_) {
+                display.drawPixel(x + px, y + py, tint);
+            }
+        }
+    }
+}
+
+// Positions sweep the whole panel, including partially clipped edges, or
+// only spots where the sprite is fully visible (where compiled frames apply)
+static int16_t posX(int i, bool inside) { return inside ? (int16_t)(i % 57) : (int16_t)(i % 72) - 4; }
+static int16_t posY(int i, bool inside) { return inside ? (int16_t)((i / 57) % 57) : (int16_t)((i / 72) % 72) - 4; }
+
+template <typename F>
+static double run(F draw, bool inside = false) {
+    display.clear();
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < DRAWS; i++) draw(posX(i, inside), posY(i, inside));
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1 - t0).count();
+}
+
+// Both paths must produce identical framebuffers, edges included
+static bool matches(void (*reference)(int16_t, int16_t), void (*candidate)(int16_t, int16_t)) {
+    static uint32_t expected[MATRIX_WIDTH * MATRIX_HEIGHT];
+    const int16_t spots[][2] = {{0, 0}, {28, 30}, {-3, 5}, {60, 61}, {-7, -7}, {63, 20}, {56, 56},
+                                {20, -2}, {-1, -1}, {40, 61}};
+    for (auto& s : spots) {
+        display.clear();
+        reference(s[0], s[1]);
+        memcpy(expected, display.getFrameBuffer(), sizeof(expected));
+        display.clear();
+        candidate(s[0], s[1]);
+        if (memcmp(expected, display.getFrameBuffer(), sizeof(expected)) != 0) return false;
+    }
+    return true;
+}
+
+// Generic path: decoded frame from SpriteCache, clz walk over the row masks
+static void genericBlit(const SpriteInstance* sprite, int16_t x, int16_t y, uint32_t tint) {
+    const SpriteDefinition* def = sprite->definition;
+    const CachedSpriteFrame* frame = SpriteCache::get(def, SpriteRenderer::getFrame(sprite), tint);
+    display.drawBlock8(x, y, frame->mask, frame->pixels, def->width, def->height, sprite->transform);
+}
+
+static void genericDraw(int16_t x, int16_t y) { genericBlit(&player, x, y, SPRITE_CACHE_NO_TINT); }
+static void genericTint(int16_t x, int16_t y) { genericBlit(&player, x, y, 0x07E0); }
+static void coldDraw(int16_t x, int16_t y) {
+    SpriteCache::clear();
+    genericDraw(x, y);
+}
+static void legacyTintGreen(int16_t x, int16_t y) { legacyTint(x, y, 0x07E0); }
+
+// SpriteRenderer: compiled frames when fully on screen, generic otherwise
+static void rendererDraw(int16_t x, int16_t y) { SpriteRenderer::draw(&display, &player, x, y); }
+static void goalGenericTint(int16_t x, int16_t y) { genericBlit(&goal, x, y, 0x07E0); }
+static void goalRendererTint(int16_t x, int16_t y) {
+    SpriteRenderer::drawWithColorTint(&display, &goal, x, y, 0x07E0);
+}
+
+// Transforms on a block that isn't 8x8, so a flip that mirrors within 8
+// pixels instead of the block's own size shows up: drawBlock8 against
+// mapping every source pixel by hand
+static const uint8_t BLOCK_COLS = 6;
+static const uint8_t BLOCK_ROWS = 5;
+static const uint8_t BLOCK_MASKS[BLOCK_ROWS] = {0xFC, 0xB4, 0x78, 0xCC, 0x9C};
+static uint16_t block_colors[BLOCK_ROWS * 8];
+static uint32_t block_pixels[BLOCK_ROWS * 8];
+static uint8_t block_transform;
+
+static void transformReference(int16_t x, int16_t y) {
+    bool swap = block_transform & XFORM_SWAP_XY;
+    uint8_t w = swap ? BLOCK_ROWS : BLOCK_COLS;
+    uint8_t h = swap ? BLOCK_COLS : BLOCK_ROWS;
+    for (uint8_t sy = 0; sy < BLOCK_ROWS; sy++) {
+        for (uint8_t sx = 0; sx < BLOCK_COLS; sx++) {
+            if (!(BLOCK_MASKS[sy] & (0x80 >> sx))) continue;
+            uint8_t u = swap ? sy : sx;
+            uint8_t v = swap ? sx : sy;
+            if (block_transform & XFORM_FLIP_H) u = w - 1 - u;
+            if (block_transform & XFORM_FLIP_V) v = h - 1 - v;
+            display.drawPixel(x + u, y + v, block_colors[sy * 8 + sx]);
+        }
+    }
+}
+
+static void transformBlock(int16_t x, int16_t y) {
+    display.drawBlock8(x, y, BLOCK_MASKS, block_pixels, BLOCK_COLS, BLOCK_ROWS, block_transform);
+}
+
+static bool transformsMatch() {
+    for (uint8_t i = 0; i < BLOCK_ROWS * 8; i++) {
+        block_colors[i] = (uint16_t)(0x1234 + i * 0x0841);
+        block_pixels[i] = DisplayManager::toNativeColor(block_colors[i]);
+    }
+    bool ok = true;
+    for (block_transform = 0; block_transform < XFORM_COUNT; block_transform++) {
+        ok = ok && matches(transformReference, transformBlock);
+    }
+    return ok;
+}
+
+static void report(const char* name, double seconds) {
+    printf("%-24s %10.1f ns/sprite %10.0f sprites/ms\n",
+           name, seconds * 1e9 / DRAWS, DRAWS / (seconds * 1e3));
+}
+
+int main() {
+    display.init();
+    SpriteRenderer::initInstance(&player, &PLAYER1_SPRITE);
+    SpriteRenderer::initInstance(&goal, &GOAL_SPRITE);
+
+    bool ok = matches(legacyDraw, genericDraw) && matches(legacyTintGreen, genericTint) &&
+              matches(genericDraw, rendererDraw) && matches(goalGenericTint, goalRendererTint);
+    printf("output check: %s\n", ok ? "identical" : "MISMATCH");
+    bool transforms_ok = transformsMatch();
+    printf("output check (%ux%u block, %d transforms): %s\n\n", BLOCK_COLS, BLOCK_ROWS, XFORM_COUNT,
+           transforms_ok ? "identical" : "MISMATCH");
+    ok = ok && transforms_ok;
+
+    double legacy_draw = run(legacyDraw);
+    double cold_draw = run(coldDraw);
+    SpriteCache::clear();
+    double mask_draw = run(genericDraw);
+    uint32_t warm_misses = SpriteCache::getMisses();
+    double legacy_tint = run(legacyTintGreen);
+    double mask_tint = run(genericTint);
+
+    report("draw (per-pixel)", legacy_draw);
+    report("draw (mask, cold)", cold_draw);
+    report("draw (mask, cached)", mask_draw);
+    report("tint (per-pixel)", legacy_tint);
+    report("tint (mask)", mask_tint);
+    printf("\ncache misses over %d warm draws: %u\n", DRAWS, (unsigned)warm_misses);
+    printf("speedup: draw %.1fx, tint %.1fx\n", legacy_draw / mask_draw, legacy_tint / mask_tint);
+
+    // Compiled frames vs the generic loop, fully on-screen positions only.
+    // tools/sprite_pipeline.py prints an estimate of their code size per sprite.
+    printf("\n");
+    double generic_inside = run(genericDraw, true);
+    double compiled_inside = run(rendererDraw, true);
+    double goal_generic = run(goalGenericTint, true);
+    double goal_compiled = run(goalRendererTint, true);
+    report("draw (generic)", generic_inside);
+    report("draw (compiled)", compiled_inside);
+    report("goal tint (generic)", goal_generic);
+    report("goal tint (compiled)", goal_compiled);
+    printf("speedup: draw %.1fx, tint %.1fx\n", generic_inside / compiled_inside, goal_generic / goal_compiled);
+
+    // Transforms should cost the same as an untransformed blit
+    static const char* const XFORM_NAMES[XFORM_COUNT] = {
+        "none", "flip h", "flip v", "rot 180", "swap xy", "rot 90", "rot 270", "anti-diagonal"
+    };
+    printf("\n");
+    for (uint8_t t = 0; t < XFORM_COUNT; t++) {
+        player.transform = t;
+        char name[32];
+        snprintf(name, sizeof(name), "draw (%s)", XFORM_NAMES[t]);
+        report(name, run(genericDraw));
+    }
+    player.transform = XFORM_NONE;
+
+    // Batch: N entities per frame at scattered positions (some off screen),
+    // mixed z and tints, submitted out of order
+    static SpriteBatch batch;
+    printf("\n");
+    const uint8_t sizes[] = {8, 24, 48, 64};
+    for (uint8_t n : sizes) {
+        const int frames = DRAWS / n;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) {
+            batch.begin();
+            for (uint8_t k = 0; k < n; k++) {
+                int i = f * 7 + k * 13;
+                const SpriteInstance* s = (k & 1) ? &goal : &player;
+                batch.submit(s, posX(i, false), posY(i * 5, false), (k * 37) & 3,
+                             (k & 1) ? 0x07E0 : SPRITE_CACHE_NO_TINT);
+            }
+            batch.flush(&display);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        char name[32];
+        snprintf(name, sizeof(name), "batch of %u", n);
+        double seconds = std::chrono::duration<double>(t1 - t0).count();
+        printf("%-24s %10.1f ns/sprite %10.1f us/frame\n",
+               name, seconds * 1e9 / (frames * n), seconds * 1e6 / frames);
+    }
+    return ok ? 0 : 1;
+}
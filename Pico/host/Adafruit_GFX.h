@@ -0,0 +1,37 @@
+// host/Adafruit_GFX.h
+// Minimal stand-in for Adafruit_GFX: the primitives DisplayManager forwards to.
+// Text is drawn with the classic 6x8 font, so host-rendered screens show it.
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size);
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c) { textcolor = c; }
+    void setTextSize(uint8_t s) { textsize = s; }
+    void setTextWrap(bool w) { wrap = w; }
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    int16_t width() const { return WIDTH; }
+    int16_t height() const { return HEIGHT; }
+
+protected:
+    const int16_t WIDTH, HEIGHT;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF;
+    uint8_t textsize = 1;
+    bool wrap = true;
+};
+
+#endif // HOST_ADAFRUIT_GFX_H
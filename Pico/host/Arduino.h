@@ -0,0 +1,88 @@
+// host/Arduino.h
+// Minimal Arduino core shim so game and display sources build on a Linux host
+// (benchmarks and tools only - the firmware build never sees this directory)
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+// Flash access is plain memory on the host
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t*)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr)   (*(void* const*)(addr))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+int analogRead(int pin);
+
+// Host-only: run millis()/micros() off a manual clock instead of wall time, so
+// sessions are deterministic and can run far faster than real time
+void hostUseManualClock(unsigned long start_us);
+void hostAdvanceMicros(unsigned long us);
+
+long random();
+long random(long max_exclusive);
+long random(long min_inclusive, long max_exclusive);
+void randomSeed(unsigned long seed);
+
+// Print: numbers and strings go to stdout (or nowhere when muted)
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buf, size_t len);
+    size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n) { return printNumber(n); }
+    size_t print(unsigned int n) { return printNumber(n); }
+    size_t print(long n) { return printNumber(n); }
+    size_t print(unsigned long n) { return printNumber((long)n); }
+    size_t print(double d, int digits = 2);
+
+    size_t println() { return write((uint8_t)'\n'); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    size_t println(double d, int digits) { size_t n = print(d, digits); return n + println(); }
+
+private:
+    size_t printNumber(long n);
+};
+
+class HardwareSerial : public Print {
+public:
+    explicit HardwareSerial(bool echo) : echo_(echo) {}
+    void begin(unsigned long) {}
+    void setTX(int) {}
+    void setRX(int) {}
+    void flush() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int availableForWrite() { return 256; }
+    operator bool() { return true; }
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    void setEcho(bool echo) { echo_ = echo; }
+
+private:
+    bool echo_;
+};
+
+extern HardwareSerial Serial;   // USB CDC -> stdout (muted by default)
+extern HardwareSerial Serial1;  // UART to the R4 -> discarded
+
+#endif // HOST_ARDUINO_H
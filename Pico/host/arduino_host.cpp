@@ -0,0 +1,85 @@
+// host/arduino_host.cpp
+// Host implementations for the Arduino core shim
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial(false);
+HardwareSerial Serial1(false);
+
+static const auto start_time = std::chrono::steady_clock::now();
+static bool manual_clock = false;
+static unsigned long long manual_us = 0;
+
+unsigned long millis() {
+    if (manual_clock) return (unsigned long)(manual_us / 1000);
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+}
+
+unsigned long micros() {
+    if (manual_clock) return (unsigned long)manual_us;
+    auto elapsed = std::chrono::steady_clock::now() - start_time;
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void delay(unsigned long ms) {
+    if (manual_clock) {
+        manual_us += ms * 1000ULL;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void hostUseManualClock(unsigned long start_us) {
+    manual_clock = true;
+    manual_us = start_us;
+}
+
+void hostAdvanceMicros(unsigned long us) {
+    manual_us += us;
+}
+
+int analogRead(int) {
+    return rand() & 0x3FF;
+}
+
+long random() {
+    return rand();
+}
+
+long random(long max_exclusive) {
+    if (max_exclusive <= 0) return 0;
+    return rand() % max_exclusive;
+}
+
+long random(long min_inclusive, long max_exclusive) {
+    if (max_exclusive <= min_inclusive) return min_inclusive;
+    return min_inclusive + rand() % (max_exclusive - min_inclusive);
+}
+
+void randomSeed(unsigned long seed) {
+    srand((unsigned int)seed);
+}
+
+size_t Print::write(const uint8_t* buf, size_t len) {
+    for (size_t i = 0; i < len; i++) write(buf[i]);
+    return len;
+}
+
+size_t Print::print(double d, int digits) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", digits, d);
+    return write(buf);
+}
+
+size_t Print::printNumber(long n) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), "%ld", n);
+    return write(buf);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (echo_) fputc(c, stdout);
+    return 1;
+}
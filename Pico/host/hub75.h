@@ -0,0 +1,45 @@
+// host/hub75.h
+// Host stand-in for the RP2040Matrix HUB75 driver API
+#ifndef HOST_HUB75_H
+#define HOST_HUB75_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISPLAY_WIDTH   64
+#define DISPLAY_HEIGHT  64
+
+typedef uint32_t rgb_t;
+
+extern uint16_t bitPlanes;
+
+void hub75_config(int bpp);
+int hub75_update(rgb_t* image, uint8_t* overlay);
+void hub75_set_masterbrightness(int brt);
+void hub75_set_overlaycolor(int index, rgb_t color);
+void hub75_set_row_window(int row, int x0, int x1);
+void hub75_reset_window(void);
+void hub75_set_scroll(int first_row, int rows, int offset);
+uint32_t hub75_get_refresh_count(void);
+
+// Host-only: where hub75_update() sends frames. The frame is shown the way the
+// panel would light it (overlay, row windows and master brightness applied).
+//   HUB75_HOST_TERMINAL: truecolor ANSI, two pixels per cell with half blocks;
+//                        path = output file, NULL for stdout
+//   HUB75_HOST_PPM:      one binary PPM per frame, path = directory
+// every: present one frame out of every N updates (1 = all)
+#define HUB75_HOST_NONE      0
+#define HUB75_HOST_TERMINAL  1
+#define HUB75_HOST_PPM       2
+int hub75_host_output(int mode, const char* path, int every);
+unsigned long hub75_host_frames(void);      // hub75_update() calls so far
+unsigned long hub75_host_presented(void);   // Frames actually written out
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_HUB75_H
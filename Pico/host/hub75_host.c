@@ -0,0 +1,215 @@
+// host/hub75_host.c
+// Host stand-in for the HUB75 driver: keeps the settings and, when an output
+// is selected, shows each frame as the panel would light it - on an ANSI
+// truecolor terminal or as PPM files
+#include "hub75.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// Master brightness the firmware runs at (GFXMatrix::begin). Frames are shown
+// relative to it, so normal screens come out at full intensity and fades dim.
+#define HOST_REFERENCE_BRIGHTNESS  20
+
+uint16_t bitPlanes = 8;
+static int masterBrightness = HOST_REFERENCE_BRIGHTNESS;
+static rgb_t overlayColors[16];
+static uint8_t windowStart[DISPLAY_HEIGHT];
+static uint8_t windowCut[DISPLAY_HEIGHT];   // Columns hidden at the right; zero = visible
+static int8_t rowShift[DISPLAY_HEIGHT];     // Image row shown = row + shift (scroll band)
+
+static int outputMode = HUB75_HOST_NONE;
+static const char* outputPath = NULL;
+static FILE* terminal = NULL;
+static int outputEvery = 1;
+static unsigned long frameCount = 0;
+static unsigned long presentedCount = 0;
+
+// Panel value -> sRGB byte at the current brightness. The framebuffer holds
+// LED duty (LEDmx_565toRGB squares each channel), so a square root brings it
+// back to roughly what a monitor expects.
+static uint8_t levelLut[256];
+static int levelLutBrightness = -1;
+
+static uint8_t frameRgb[DISPLAY_HEIGHT][DISPLAY_WIDTH][3];
+
+// Worst case per cell: two 19-byte color escapes plus the 3-byte half block
+static char termBuf[DISPLAY_HEIGHT / 2 * (DISPLAY_WIDTH * 41 + 8) + 16];
+static char decimal[256][4];
+static uint8_t decimalLen[256];
+
+void hub75_config(int bpp) {
+    if (bpp < 4) bpp = 4;
+    if (bpp > 8) bpp = 8;
+    bitPlanes = bpp;
+}
+
+void hub75_set_masterbrightness(int brt) {
+    masterBrightness = brt;
+}
+
+void hub75_set_overlaycolor(int index, rgb_t color) {
+    if (index < 1 || index > 15) return;
+    overlayColors[index] = color;
+}
+
+void hub75_set_row_window(int row, int x0, int x1) {
+    if (row < 0 || row >= DISPLAY_HEIGHT) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (x1 < x0) x1 = x0;
+    windowStart[row] = x0;
+    windowCut[row] = DISPLAY_WIDTH - x1;
+}
+
+void hub75_reset_window(void) {
+    for (int row = 0; row < DISPLAY_HEIGHT; row++) {
+        windowStart[row] = 0;
+        windowCut[row] = 0;
+    }
+}
+
+void hub75_set_scroll(int first_row, int rows, int offset) {
+    memset(rowShift, 0, sizeof(rowShift));
+    if (first_row < 0 || rows <= 0 || first_row + rows > DISPLAY_HEIGHT) return;
+    offset %= rows;
+    if (offset < 0) offset += rows;
+    for (int s = 0; s < rows; s++) {
+        rowShift[first_row + s] = (int8_t)((s + offset) % rows - s);
+    }
+}
+
+static void buildLevelLut(void) {
+    double scale = (double)masterBrightness / HOST_REFERENCE_BRIGHTNESS;
+    if (scale > 1.0) scale = 1.0;
+    if (scale < 0.0) scale = 0.0;
+    for (int v = 0; v < 256; v++) {
+        levelLut[v] = (uint8_t)(sqrt(v * scale / 255.0) * 255.0 + 0.5);
+    }
+    levelLutBrightness = masterBrightness;
+}
+
+// Compose what the panel would show into frameRgb
+static void composeFrame(const rgb_t* image, const uint8_t* overlay) {
+    if (levelLutBrightness != masterBrightness) buildLevelLut();
+
+    for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+        int row = y + rowShift[y];
+        const rgb_t* ip = image + row * DISPLAY_WIDTH;
+        const uint8_t* op = overlay + row * DISPLAY_WIDTH;
+        int x0 = windowStart[y];
+        int x1 = DISPLAY_WIDTH - windowCut[y];
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            uint8_t* out = frameRgb[y][x];
+            if (x < x0 || x >= x1) {
+                out[0] = out[1] = out[2] = 0;
+                continue;
+            }
+            rgb_t px = op[x] ? overlayColors[op[x]] : ip[x];
+            out[0] = levelLut[(px >> 16) & 0xFF];
+            out[1] = levelLut[(px >> 8) & 0xFF];
+            out[2] = levelLut[px & 0xFF];
+        }
+    }
+}
+
+static char* putColor(char* p, char layer, const uint8_t* c) {
+    // ESC[38;2;R;G;Bm (foreground) / ESC[48;2;R;G;Bm (background)
+    *p++ = '\x1b'; *p++ = '['; *p++ = layer; *p++ = '8'; *p++ = ';'; *p++ = '2';
+    for (int i = 0; i < 3; i++) {
+        *p++ = ';';
+        memcpy(p, decimal[c[i]], decimalLen[c[i]]);
+        p += decimalLen[c[i]];
+    }
+    *p++ = 'm';
+    return p;
+}
+
+// Upper pixel as foreground of U+2580 (upper half block), lower as background;
+// escapes are only emitted when a color changes along the row
+static void presentTerminal(void) {
+    if (decimalLen[0] == 0) {
+        for (int i = 0; i < 256; i++) {
+            decimalLen[i] = (uint8_t)snprintf(decimal[i], sizeof(decimal[i]), "%d", i);
+        }
+    }
+
+    char* p = termBuf;
+    memcpy(p, "\x1b[H", 3);     // Cursor home: each frame overdraws the last
+    p += 3;
+    for (int y = 0; y < DISPLAY_HEIGHT; y += 2) {
+        const uint8_t* fg = NULL;
+        const uint8_t* bg = NULL;
+        for (int x = 0; x < DISPLAY_WIDTH; x++) {
+            const uint8_t* top = frameRgb[y][x];
+            const uint8_t* bottom = frameRgb[y + 1][x];
+            if (fg == NULL || memcmp(fg, top, 3) != 0) p = putColor(p, '3', top);
+            if (bg == NULL || memcmp(bg, bottom, 3) != 0) p = putColor(p, '4', bottom);
+            fg = top;
+            bg = bottom;
+            memcpy(p, "\xe2\x96\x80", 3);
+            p += 3;
+        }
+        memcpy(p, "\x1b[0m\n", 5);
+        p += 5;
+    }
+    fwrite(termBuf, 1, (size_t)(p - termBuf), terminal);
+    fflush(terminal);
+}
+
+static void presentPpm(void) {
+    char name[512];
+    snprintf(name, sizeof(name), "%s/frame_%06lu.ppm", outputPath, frameCount - 1);
+    FILE* f = fopen(name, "wb");
+    if (f == NULL) return;
+    fprintf(f, "P6\n%d %d\n255\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    fwrite(frameRgb, 1, sizeof(frameRgb), f);
+    fclose(f);
+}
+
+int hub75_host_output(int mode, const char* path, int every) {
+    if (terminal != NULL && terminal != stdout) fclose(terminal);
+    terminal = NULL;
+
+    outputMode = mode;
+    outputPath = path;
+    outputEvery = every < 1 ? 1 : every;
+
+    if (mode == HUB75_HOST_TERMINAL) {
+        terminal = path ? fopen(path, "w") : stdout;
+        if (terminal == NULL) {
+            outputMode = HUB75_HOST_NONE;
+            return -1;
+        }
+        fputs("\x1b[2J", terminal);     // Clear once; frames then overdraw in place
+    }
+    return 0;
+}
+
+uint32_t hub75_get_refresh_count(void) {
+    return 0;   // No scan-out on the host
+}
+
+unsigned long hub75_host_frames(void) {
+    return frameCount;
+}
+
+unsigned long hub75_host_presented(void) {
+    return presentedCount;
+}
+
+int hub75_update(rgb_t* image, uint8_t* overlay) {
+    frameCount++;
+    if (outputMode == HUB75_HOST_NONE || (frameCount - 1) % outputEvery != 0) {
+        return 0;
+    }
+
+    composeFrame(image, overlay);
+    if (outputMode == HUB75_HOST_TERMINAL) {
+        presentTerminal();
+    } else {
+        presentPpm();
+    }
+    presentedCount++;
+    return 0;
+}
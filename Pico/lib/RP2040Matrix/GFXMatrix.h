@@ -12,7 +12,10 @@ public:
   void display();
   void begin();
   void clear();
-private:
+
+  // Direct access for span/blend kernels (row-major, WIDTH*HEIGHT native pixels)
+  uint32_t *getBuffer() { return buffer; }
+
   static uint32_t LEDmx_565toRGB(uint16_t pix) {
     uint32_t r_gamma = pix & 0xf800u;
     r_gamma *= r_gamma;
@@ -23,8 +26,7 @@ private:
     return (r_gamma >> 24 << 16) | (g_gamma >> 14 << 8) | (b_gamma >> 2 << 0);
   }
 
-
-
+private:
   uint32_t *buffer = nullptr;
   uint8_t *overlay_buffer = nullptr;
 
@@ -259,6 +259,41 @@ void    hub75_set_masterbrightness(int brt);
  */
 void    hub75_set_overlaycolor(int index, rgb_t color);
 
+/*! \brief Limit one display row to a span of columns
+ *  \ingroup HUB75
+ *
+ * \param row Display row (0 .. DISPLAY_HEIGHT-1)
+ * \param x0 First visible column
+ * \param x1 One past the last visible column
+ * Pixels outside [x0, x1) are sent dark by the next hub75_update(), without touching the
+ * image. An empty span (x1 <= x0) blanks the row.
+ */
+void    hub75_set_row_window(int row, int x0, int x1);
+
+/*! \brief Make every row fully visible again
+ *  \ingroup HUB75
+ */
+void    hub75_reset_window(void);
+
+/*! \brief Scroll a band of rows vertically
+ *  \ingroup HUB75
+ *
+ * \param first_row First display row of the band
+ * \param rows Height of the band; 0 turns scrolling off
+ * \param offset Rows the band's content is moved up (wraps around within the band)
+ * Display row first_row + s shows image/overlay row first_row + (s + offset) % rows from the
+ * next hub75_update() on. The band works as a ring: to scroll by one row, advance offset and
+ * redraw only the image row that comes in at the bottom.
+ */
+void    hub75_set_scroll(int first_row, int rows, int offset);
+
+/*! \brief Number of complete display cycles (all bit planes) shown so far
+ *  \ingroup HUB75
+ *
+ * Sampled twice, the difference over the elapsed time gives the refresh rate.
+ */
+uint32_t hub75_get_refresh_count(void);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
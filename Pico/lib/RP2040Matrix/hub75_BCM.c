@@ -35,6 +35,7 @@ uint32_t frameBuffer[DISPLAY_MAXPLANES * (DISPLAY_WIDTH / 2) * DISPLAY_SCAN]; //
 #endif
 rgb_t* addrBuffer[(1<<DISPLAY_MAXPLANES)];
 uint16_t  bcmCounter = 1;     // index in addrBuffer array
+static volatile uint32_t refreshCount = 0;  // completed display cycles
 
 uint32_t ctrlBuffer[DISPLAY_MAXPLANES * DISPLAY_SCAN]; // N bit planes * # of scan lines
 
@@ -52,6 +53,34 @@ static int ctrl_dma_chan;
 
 static rgb_t overlayColors[16];
 
+// Visible span of each display row: [windowStart, DISPLAY_WIDTH - windowCut).
+// Pixels outside it are sent dark; all zero = whole panel visible
+static uint8_t windowStart[DISPLAY_HEIGHT];
+static uint8_t windowCut[DISPLAY_HEIGHT];
+
+// Image row shown on each display row, as a delta (hub75_set_scroll); all zero = no scroll
+static int8_t rowShift[DISPLAY_HEIGHT];
+
+// Set while any row has a window narrower than the panel; hub75_update()
+// skips windowing entirely otherwise
+static bool windowsActive = false;
+
+// Darken the pixels of display row `row` outside its window in one packed bit
+// plane row: each word holds lanes of `lane` bits, one pixel per lane, and the
+// row's three color bits sit `shift` bits into the lane
+static void clipRowWindow(uint32_t* packed, int row, int lane, int shift)
+{
+    int perWord = 32 / lane;
+    int x0 = windowStart[row];
+    int x1 = DISPLAY_WIDTH - windowCut[row];
+    int x;
+
+    for (x = 0; x < x0; x++)
+        packed[x / perWord] &= ~(7u << ((x % perWord) * lane + shift));
+    for (x = x1; x < DISPLAY_WIDTH; x++)
+        packed[x / perWord] &= ~(7u << ((x % perWord) * lane + shift));
+}
+
 
 static void dma_hub75_handler()
 {
@@ -65,6 +94,7 @@ static void dma_hub75_handler()
         {
             gpio_xor_mask(1<<15);       // debug LED for frame time measurement
             bcmCounter = 1;
+            refreshCount++;
         }
     }
     if (dma_hw->ints0 & (1u << ctrl_dma_chan))
@@ -303,6 +333,50 @@ void hub75_set_overlaycolor(int index, rgb_t color)
 
 
 
+void hub75_set_row_window(int row, int x0, int x1)
+{
+    if (row < 0 || row >= DISPLAY_HEIGHT)
+        return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > DISPLAY_WIDTH) x1 = DISPLAY_WIDTH;
+    if (x1 < x0) x1 = x0;
+    windowStart[row] = x0;
+    windowCut[row] = DISPLAY_WIDTH - x1;
+    if (x0 > 0 || x1 < DISPLAY_WIDTH)
+        windowsActive = true;
+}
+
+
+
+uint32_t hub75_get_refresh_count(void)
+{
+    return refreshCount;
+}
+
+
+
+void hub75_reset_window(void)
+{
+    memset(windowStart, 0, sizeof(windowStart));
+    memset(windowCut, 0, sizeof(windowCut));
+    windowsActive = false;
+}
+
+
+
+void hub75_set_scroll(int first_row, int rows, int offset)
+{
+    memset(rowShift, 0, sizeof(rowShift));
+    if (first_row < 0 || rows <= 0 || first_row + rows > DISPLAY_HEIGHT)
+        return;
+    offset %= rows;
+    if (offset < 0) offset += rows;
+    for (int s = 0; s < rows; s++)
+        rowShift[first_row + s] = (s + offset) % rows - s;
+}
+
+
+
 #if HUB75_SIZE == 4040
 int hub75_update(rgb_t *image, uint8_t *overlay)
 {
@@ -320,10 +394,12 @@ int hub75_update(rgb_t *image, uint8_t *overlay)
 
         for (y = 0; y < DISPLAY_SCAN; y++)
         {
-            rgb_t* ip_uu = image + (y * DISPLAY_WIDTH);
-            rgb_t* ip_lu = image + ((y + DISPLAY_SCAN) * DISPLAY_WIDTH);
-            uint8_t* op_uu = overlay + (y * DISPLAY_WIDTH);
-            uint8_t* op_lu = overlay + ((y + DISPLAY_SCAN) * DISPLAY_WIDTH);
+            int rowU = y + rowShift[y];
+            int rowL = y + DISPLAY_SCAN + rowShift[y + DISPLAY_SCAN];
+            rgb_t* ip_uu = image + (rowU * DISPLAY_WIDTH);
+            rgb_t* ip_lu = image + (rowL * DISPLAY_WIDTH);
+            uint8_t* op_uu = overlay + (rowU * DISPLAY_WIDTH);
+            uint8_t* op_lu = overlay + (rowL * DISPLAY_WIDTH);
 
             brtCnt = 0;
             for (x = 0; x < DISPLAY_WIDTH / 4; x++)     // 4 pixels per framebuffer word
@@ -401,6 +477,12 @@ int hub75_update(rgb_t *image, uint8_t *overlay)
                 *fp++ = img;
             }
 
+            if (windowsActive)      // Transition in progress: one check per row otherwise
+            {
+                clipRowWindow(fp - DISPLAY_WIDTH / 4, y, 8, 0);
+                clipRowWindow(fp - DISPLAY_WIDTH / 4, y + DISPLAY_SCAN, 8, 3);
+            }
+
             uint32_t ctrl = ((y) & 0x1F);                           // ADDR lines: bits 0..4
 
             *cp++ = ctrl;
@@ -428,14 +510,18 @@ int hub75_update(rgb_t* image, uint8_t* overlay)
 
         for (y = 0; y < DISPLAY_SCAN; y++)
         {
-            rgb_t* ip_uu = image + (y * DISPLAY_WIDTH);
-            rgb_t* ip_lu = image + ((y + DISPLAY_SCAN) * DISPLAY_WIDTH);
-            rgb_t* ip_ul = image + ((y + DISPLAY_HEIGHT/2) * DISPLAY_WIDTH);
-            rgb_t* ip_ll = image + (((y + DISPLAY_HEIGHT / 2) + DISPLAY_SCAN) * DISPLAY_WIDTH);
-            uint8_t* op_uu = overlay + (y * DISPLAY_WIDTH);
-            uint8_t* op_lu = overlay + ((y + DISPLAY_SCAN) * DISPLAY_WIDTH);
-            uint8_t* op_ul = overlay + ((y + DISPLAY_HEIGHT / 2) * DISPLAY_WIDTH);
-            uint8_t* op_ll = overlay + (((y + DISPLAY_HEIGHT / 2) + DISPLAY_SCAN) * DISPLAY_WIDTH);
+            int rowUU = y + rowShift[y];
+            int rowLU = y + DISPLAY_SCAN + rowShift[y + DISPLAY_SCAN];
+            int rowUL = y + DISPLAY_HEIGHT / 2 + rowShift[y + DISPLAY_HEIGHT / 2];
+            int rowLL = y + DISPLAY_HEIGHT / 2 + DISPLAY_SCAN + rowShift[y + DISPLAY_HEIGHT / 2 + DISPLAY_SCAN];
+            rgb_t* ip_uu = image + (rowUU * DISPLAY_WIDTH);
+            rgb_t* ip_lu = image + (rowLU * DISPLAY_WIDTH);
+            rgb_t* ip_ul = image + (rowUL * DISPLAY_WIDTH);
+            rgb_t* ip_ll = image + (rowLL * DISPLAY_WIDTH);
+            uint8_t* op_uu = overlay + (rowUU * DISPLAY_WIDTH);
+            uint8_t* op_lu = overlay + (rowLU * DISPLAY_WIDTH);
+            uint8_t* op_ul = overlay + (rowUL * DISPLAY_WIDTH);
+            uint8_t* op_ll = overlay + (rowLL * DISPLAY_WIDTH);
 
             brtCnt = 0;
             for (x = 0; x < DISPLAY_WIDTH / 2; x++)     // 4 pixels per framebuffer word
@@ -501,6 +587,14 @@ int hub75_update(rgb_t* image, uint8_t* overlay)
                 *fp++ = img;
             }
 
+            if (windowsActive)      // Transition in progress: one check per row otherwise
+            {
+                clipRowWindow(fp - DISPLAY_WIDTH / 2, y, 16, 0);
+                clipRowWindow(fp - DISPLAY_WIDTH / 2, y + DISPLAY_SCAN, 16, 3);
+                clipRowWindow(fp - DISPLAY_WIDTH / 2, y + DISPLAY_HEIGHT / 2, 16, 6);
+                clipRowWindow(fp - DISPLAY_WIDTH / 2, y + DISPLAY_HEIGHT / 2 + DISPLAY_SCAN, 16, 9);
+            }
+
             uint32_t ctrl = ((y) & 0x1F);                           // ADDR lines: bits 0..4
 
             *cp++ = ctrl;
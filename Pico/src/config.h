@@ -19,6 +19,15 @@
 // Control pins (must be consecutive):
 //   GP11 = LATCH, GP12 = OE (Output Enable), GP13 = CLK (Clock)
 
+// Framebuffer capture over USB serial ('C' = one frame, 'X' = toggle stream)
+#define FRAME_STREAM_INTERVAL_MS 500  // Continuous stream rate (2 FPS)
+#define LOG_HOLD_BYTES           512  // Log text held back while a frame is being sent
+
+// Tuning console on USB serial: lines starting with ':' (":list", ":set brightness 40")
+#define CONSOLE_LINE_LEN       48
+#define CONSOLE_MAX_PARAMS     12
+#define CONSOLE_STATS_FRAMES   60   // Frame time / refresh rate averaging window
+
 // UART pins for R4 communication (UART0 on GP16/GP17)
 #define UART_TX_PIN  16      // GP16 Sends back to R4
 #define UART_RX_PIN  17      // GP17 receives from R4 TX
@@ -32,6 +41,7 @@
 // Joystick thresholds (raw ADC 0-1023, center ~512)
 #define JOY_CENTER      512
 #define JOY_DEADZONE    100  // Must exceed this from center to register direction
+#define DIRECTION_DEBOUNCE_MS  150  // Same direction repeats no faster than this
 
 // Button mask bits in packet byte 6
 #define BTN_MASK_JSW    (1 << 0)  // Joystick switch
@@ -52,10 +62,45 @@
 
 #define MAZE_WIDTH        (MATRIX_WIDTH / CELL_SIZE)   // 64/8 = 8 cells
 #define MAZE_HEIGHT       7                            // 7 cells (56 pixels high)
+#define MAZE_CELLS        (MAZE_WIDTH * MAZE_HEIGHT)   // Fits a uint64_t cell mask
 
 #define START_X        0
 #define START_Y        0
 
+// Exits generated per visited cell (picked uniformly in this range)
+#define MAZE_MIN_EXITS 1
+#define MAZE_MAX_EXITS 3
+
+// Placement by path distance (flood fill over passable sides): player 2 spawns at least
+// SPAWN_MIN_PATH_DIST steps from player 1, the goal at least GOAL_*_PATH_DIST
+// from the nearer player - or as far as the grid allows when no cell is that far
+#define SPAWN_MIN_PATH_DIST       5
+#define GOAL_START_PATH_DIST      10
+#define GOAL_RELOCATE_PATH_DIST   7
+
+// Persistent mode: carve a real maze (walls kept for the whole game) with one of
+// the MazeAlgorithmId generators instead of re-rolling exits on every move
+#define MAZE_PERSISTENT 0
+#define MAZE_ALGORITHM  MAZE_ALGO_BACKTRACKER
+
+// Chunked world (MazeWorld) for mazes larger than SRAM: chunks of 2^SHIFT cells
+// square (16 x 16 = 64 B of walls), carved on first use, MAZE_CHUNK_CACHE kept
+#define MAZE_CHUNK_SHIFT  4
+#define MAZE_CHUNK_CACHE  16
+
+// Frame pacing - render at a locked rate, input/acks are serviced every loop pass
+#define FRAME_INTERVAL_US  16667  // 60 FPS
+
+// Work out the active player's four possible moves after each frame, so a move
+// arriving from the R4 only commits a ready result before the ack goes back.
+// Off by default: the ack is already early because a move's aftermath waits
+// for GameState::finishMove(), and a prepared plan is no faster than deciding
+// on arrival (slower in the memoryless maze, see bench/bench_move_ack.cpp)
+#define MOVE_SPECULATE     0
+
+// Player sprites glide between cells over this many ms (cell logic is instant)
+#define MOVE_TWEEN_MS      120
+
 // Two-player colors (RGB565)
 #define PLAYER1_COLOR  0x5F0B  // Green
 #define PLAYER2_COLOR  0xF800  // Magenta/Red
@@ -63,12 +108,65 @@
 #define P2_FOG_COLOR   0x780F  // Purple
 #define ACTIVE_HIGHLIGHT 0xFFFF // White border for active player
 
-// Goal distance color progression (RGB565) - heat map: red=far, green=close
+// Layer opacity (0-255) - fog and blocked markers are blended, so the two
+// players' overlapping neighbourhoods mix instead of overwriting each other
+#define FOG_ALPHA          160
+#define BLOCKED_ALPHA      200
+
+// Goal distance color progression (RGB565) - heat map by moves along open
+// passages from the nearer player (unreachable = far): red=far, green=close
 #define GOAL_DIST_FAR      0xF800  // Red - far away (>= 10 cells)
 #define GOAL_DIST_MEDIUM   0xFD20  // Orange - medium distance (5-9 cells)
 #define GOAL_DIST_CLOSE    0xFFE0  // Yellow - close (2-4 cells)
 #define GOAL_DIST_ADJACENT 0x07E0  // Green - adjacent (1 cell)
 
+// Celebration particles (fixed pool, no heap)
+#define PARTICLE_CAPACITY  256
+#define GOAL_BURST_COUNT   48   // Burst + sparks when a player reaches the goal
+#define WIN_CONFETTI_RATE  3    // New confetti flakes per frame on the win screen
+
+// Scrolling text (marquee) lanes
+#define MARQUEE_MAX_LANES    2
+#define MARQUEE_MAX_TEXT_PX  256  // Strip width per lane (text + gap), 8 rows of 1bpp
+#define MARQUEE_GAP_PX       24   // Blank pixels before the text repeats
+
+// Start screen backdrop: an endless maze (MazeStream) scrolling up between the
+// title and the prompt. The driver scrolls the band; only the pixel row coming
+// in is drawn per step, and a new maze row is generated every ATTRACT_CELL_SIZE steps.
+#define ATTRACT_MAZE_Y        32      // First panel row of the band
+#define ATTRACT_MAZE_ROWS     5       // Cell rows visible
+#define ATTRACT_CELL_SIZE     4       // Pixels per cell, wall included
+#define ATTRACT_SCROLL_MS     80      // One pixel row per step
+#define ATTRACT_WALL_COLOR    0x2945  // Dim grey
+
+// Screen transitions per state change: { type, out ms, in ms }. The old screen
+// is shown during "out", the new one during "in"; {TRANSITION_CUT, 0, 0} = hard cut
+#define TRANSITION_START_TO_PLAYING  { TRANSITION_IRIS, 200, 400 }
+#define TRANSITION_PLAYING_TO_GOAL   { TRANSITION_FADE, 150, 150 }
+#define TRANSITION_GOAL_TO_PLAYING   { TRANSITION_WIPE, 0, 300 }
+#define TRANSITION_TO_WIN            { TRANSITION_FADE, 300, 400 }
+#define TRANSITION_TO_START          { TRANSITION_FADE, 0, 300 }
+
+// Decoded sprite frames kept in SRAM (~280 bytes each). 56 holds every clip of
+// both players, the items, and the goal in every tint it can be drawn with,
+// so play never evicts.
+#define SPRITE_CACHE_ENTRIES 56
+
+// Maze entities: keys open one closed exit, traps cost the next turn,
+// hazards patrol and block the cell they stand on
+#define ENTITY_CAPACITY   32
+#define ENTITY_KEYS       2   // Spawned per round
+#define ENTITY_TRAPS      2
+#define ENTITY_HAZARDS    1
+#define HAZARD_STEP_MS    900
+
+// Sprite batch: entities queued per frame and their draw order (higher = on top)
+#define SPRITE_BATCH_CAPACITY 64
+#define Z_GOAL            0
+#define Z_ITEM            0   // Items never share a cell with the goal
+#define Z_PLAYER          1
+#define Z_ACTIVE_PLAYER   2
+
 // Blocked direction and goal accessibility indicators
 #define BLOCKED_COLOR      0xF800  // Red - blocked path indicator
 #define GOAL_ACCESSIBLE    0x001F  // Blue - goal is accessible (open door)
@@ -95,4 +193,8 @@
 #define TEXT_WIN_L4         "rabbit"
 #define TEXT_WIN_L5         "hole..."
 
+// Marquee speeds on the win screen (Q8.8 pixels per frame)
+#define WIN_HEADLINE_SPEED  96   // Winner line, ~0.4 px/frame
+#define WIN_MESSAGE_SPEED   192  // "one more rabbit hole...", ~0.75 px/frame
+
 #endif // CONFIG_H
\ No newline at end of file
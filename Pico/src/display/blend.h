@@ -0,0 +1,39 @@
+// display/blend.h
+// Packed (SWAR) alpha blend kernels for RGB565 colors and the matrix's native 0x00RRGGBB buffer
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <stdint.h>
+
+// Alpha convention for all kernels: 0 = keep dst, 255 = replace with src
+
+// Blend two 0x00RRGGBB pixels. R and B are blended together in one 32-bit
+// multiply (16 bits of headroom per lane), G in a second one.
+static inline uint32_t blend888(uint32_t dst, uint32_t src, uint8_t alpha) {
+    uint32_t a = alpha + (alpha >> 7);  // 0..256 so 255 reaches src exactly
+    uint32_t ia = 256 - a;
+
+    uint32_t rb = ((src & 0x00FF00FFu) * a + (dst & 0x00FF00FFu) * ia) >> 8;
+    uint32_t g  = ((src & 0x0000FF00u) * a + (dst & 0x0000FF00u) * ia) >> 8;
+    return (rb & 0x00FF00FFu) | (g & 0x0000FF00u);
+}
+
+// Blend a precomputed (src * a) term into dst. Used by span fills where the
+// source color is constant, saving two multiplies per pixel.
+static inline uint32_t blend888Premul(uint32_t dst, uint32_t src_rb_a, uint32_t src_g_a, uint32_t ia) {
+    uint32_t rb = (src_rb_a + (dst & 0x00FF00FFu) * ia) >> 8;
+    uint32_t g  = (src_g_a  + (dst & 0x0000FF00u) * ia) >> 8;
+    return (rb & 0x00FF00FFu) | (g & 0x0000FF00u);
+}
+
+// Blend two RGB565 colors. The 16-bit value is spread to 0b00000GGGGGG00000RRRRR000000BBBBB
+// so all three channels share a single multiply with 5 bits of headroom each.
+static inline uint16_t blend565(uint16_t dst, uint16_t src, uint8_t alpha) {
+    uint32_t a = (alpha + 4) >> 3;      // 0..32
+    uint32_t d = (dst | ((uint32_t)dst << 16)) & 0x07E0F81Fu;
+    uint32_t s = (src | ((uint32_t)src << 16)) & 0x07E0F81Fu;
+    uint32_t r = ((s * a + d * (32 - a)) >> 5) & 0x07E0F81Fu;
+    return (uint16_t)(r | (r >> 16));
+}
+
+#endif // BLEND_H
@@ -1,6 +1,8 @@
 // display/display_manager.cpp
 #include "display_manager.h"
 #include "../config.h"
+#include "blend.h"
+#include "../serial_log.h"
 
 extern "C" {
     #include "hub75.h"
@@ -9,6 +11,9 @@ extern "C" {
 DisplayManager::DisplayManager() {
     // Create GFXMatrix object for 64x64 display
     matrix = new GFXMatrix(MATRIX_WIDTH, MATRIX_HEIGHT);
+    master_brightness = 20;  // GFXMatrix::begin() defaults
+    brightness = 85;
+    bit_planes = 8;
 }
 
 DisplayManager::~DisplayManager() {
@@ -19,11 +24,11 @@ DisplayManager::~DisplayManager() {
 
 bool DisplayManager::init() {
     if (matrix == nullptr) {
-        Serial.println("ERROR: Matrix object is null!");
+        Log.println("ERROR: Matrix object is null!");
         return false;
     }
 
-    Serial.println("Initializing GFXMatrix display...");
+    Log.println("Initializing GFXMatrix display...");
 
     // Initialize the HUB75 hardware
     matrix->begin();
@@ -32,11 +37,11 @@ bool DisplayManager::init() {
     matrix->clear();
     matrix->display();
 
-    Serial.println("Display initialized successfully!");
-    Serial.println("Pin Configuration (PCB_LAYOUT_V1):");
-    Serial.println("  Data pins: GP0-GP5 (R0,G0,B0,R1,G1,B1)");
-    Serial.println("  Row select: GP6-GP10 (A,B,C,D,E)");
-    Serial.println("  LATCH: GP11, OE: GP12, CLK: GP13");
+    Log.println("Display initialized successfully!");
+    Log.println("Pin Configuration (PCB_LAYOUT_V1):");
+    Log.println("  Data pins: GP0-GP5 (R0,G0,B0,R1,G1,B1)");
+    Log.println("  Row select: GP6-GP10 (A,B,C,D,E)");
+    Log.println("  LATCH: GP11, OE: GP12, CLK: GP13");
 
     return true;
 }
@@ -70,6 +75,156 @@ void DisplayManager::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16
     }
 }
 
+void DisplayManager::blendPixel(int16_t x, int16_t y, uint16_t color, uint8_t alpha) {
+    if (x < 0 || x >= MATRIX_WIDTH || y < 0 || y >= MATRIX_HEIGHT) {
+        return;
+    }
+
+    if (matrix != nullptr) {
+        uint32_t* px = &matrix->getBuffer()[y * MATRIX_WIDTH + x];
+        *px = blend888(*px, GFXMatrix::LEDmx_565toRGB(color), alpha);
+    }
+}
+
+void DisplayManager::blendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha) {
+    if (matrix == nullptr || alpha == 0) return;
+
+    // Clip once for the whole rect
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > MATRIX_WIDTH)  w = MATRIX_WIDTH - x;
+    if (y + h > MATRIX_HEIGHT) h = MATRIX_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
+
+    // Color conversion and the source half of the blend are constant per rect
+    uint32_t src = GFXMatrix::LEDmx_565toRGB(color);
+    uint32_t a = alpha + (alpha >> 7);
+    uint32_t ia = 256 - a;
+    uint32_t src_rb_a = (src & 0x00FF00FFu) * a;
+    uint32_t src_g_a  = (src & 0x0000FF00u) * a;
+
+    uint32_t* row = &matrix->getBuffer()[y * MATRIX_WIDTH + x];
+    for (int16_t py = 0; py < h; py++) {
+        for (int16_t px = 0; px < w; px++) {
+            row[px] = blend888Premul(row[px], src_rb_a, src_g_a, ia);
+        }
+        row += MATRIX_WIDTH;
+    }
+}
+
+void DisplayManager::blendFrame(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t thickness,
+                                uint16_t color, uint8_t alpha) {
+    // Top and bottom bands span the full width; side bands fill the gap between them
+    blendRect(x, y, w, thickness, color, alpha);
+    blendRect(x, y + h - thickness, w, thickness, color, alpha);
+    blendRect(x, y + thickness, thickness, h - 2 * thickness, color, alpha);
+    blendRect(x + w - thickness, y + thickness, thickness, h - 2 * thickness, color, alpha);
+}
+
+void DisplayManager::drawRowMask(int16_t x, int16_t y, uint64_t mask, uint16_t color) {
+    if (matrix == nullptr || y < 0 || y >= MATRIX_HEIGHT) return;
+
+    // Clip horizontally by trimming the mask instead of testing every pixel
+    if (x < 0) {
+        if (x <= -64) return;
+        mask <<= -x;
+        x = 0;
+    }
+    if (x >= MATRIX_WIDTH) return;
+    int16_t visible = MATRIX_WIDTH - x;
+    if (visible < 64) {
+        mask &= ~0ULL << (64 - visible);
+    }
+
+    uint32_t native = GFXMatrix::LEDmx_565toRGB(color);
+    uint32_t* row = &matrix->getBuffer()[y * MATRIX_WIDTH + x];
+    while (mask) {
+        uint8_t px = __builtin_clzll(mask);
+        row[px] = native;
+        mask &= ~(0x8000000000000000ULL >> px);
+    }
+}
+
+uint8_t DisplayManager::clipMask8(int16_t pos, int16_t limit) {
+    if (pos <= -8 || pos >= limit) return 0;
+    uint8_t mask = 0xFF;
+    if (pos < 0) mask >>= -pos;
+    if (pos > limit - 8) mask &= (uint8_t)(0xFF << (pos - (limit - 8)));
+    return mask;
+}
+
+static inline uint8_t reverseBits8(uint8_t b) {
+    b = (b >> 4) | (b << 4);
+    b = ((b & 0xCC) >> 2) | ((b & 0x33) << 2);
+    return ((b & 0xAA) >> 1) | ((b & 0x55) << 1);
+}
+
+// One instantiation per transform: where a source row lands and which way its
+// pixels step are compile-time constants, so the inner loop is the same
+// clz walk as an untransformed copy with no per-pixel branches.
+template <uint8_t T>
+void DisplayManager::blitBlock8(int16_t x, int16_t y, const uint8_t* row_masks,
+                                const uint32_t* pixels, uint8_t cols, uint8_t rows) {
+    const bool swap = T & XFORM_SWAP_XY;
+    const bool flip_h = T & XFORM_FLIP_H;
+    const bool flip_v = T & XFORM_FLIP_V;
+
+    // Clip once in destination space, then map to source space: which source
+    // columns survive, and a visibility bit per source row
+    uint8_t dst_cols = clipMask8(x, MATRIX_WIDTH);
+    uint8_t dst_rows = clipMask8(y, MATRIX_HEIGHT);
+    if (dst_cols == 0 || dst_rows == 0) return;
+
+    // A flip mirrors within the block's own cols x rows, so a reversed mask is
+    // shifted back up by the unused part of the 8-bit span
+    uint8_t src_cols, src_rows;
+    if (swap) {
+        src_cols = flip_v ? (uint8_t)(reverseBits8(dst_rows) << (8 - cols)) : dst_rows;
+        src_rows = flip_h ? (uint8_t)(reverseBits8(dst_cols) << (8 - rows)) : dst_cols;
+    } else {
+        src_cols = flip_h ? (uint8_t)(reverseBits8(dst_cols) << (8 - cols)) : dst_cols;
+        src_rows = flip_v ? (uint8_t)(reverseBits8(dst_rows) << (8 - rows)) : dst_rows;
+    }
+
+    // Source row sy starts at origin(sy) and each source column steps by `step`
+    const int16_t step = swap ? (flip_v ? -MATRIX_WIDTH : MATRIX_WIDTH) : (flip_h ? -1 : 1);
+    uint32_t* base = matrix->getBuffer() + y * MATRIX_WIDTH + x;
+
+    for (uint8_t sy = 0; sy < rows; sy++) {
+        uint8_t m = row_masks[sy] & src_cols;
+        if (!(src_rows & (0x80 >> sy)) || m == 0) continue;
+
+        uint32_t* origin;
+        if (swap) {
+            origin = base + (flip_h ? rows - 1 - sy : sy) + (flip_v ? (cols - 1) * MATRIX_WIDTH : 0);
+        } else {
+            origin = base + (flip_v ? rows - 1 - sy : sy) * MATRIX_WIDTH + (flip_h ? cols - 1 : 0);
+        }
+        const uint32_t* src = pixels + sy * 8;
+        while (m) {
+            uint8_t sx = __builtin_clz((uint32_t)m) - 24;
+            origin[sx * step] = src[sx];
+            m &= ~(0x80 >> sx);
+        }
+    }
+}
+
+void DisplayManager::drawBlock8(int16_t x, int16_t y, const uint8_t* row_masks, const uint32_t* pixels,
+                                uint8_t cols, uint8_t rows, uint8_t transform) {
+    if (matrix == nullptr) return;
+
+    switch (transform & (XFORM_COUNT - 1)) {
+        case 0: blitBlock8<0>(x, y, row_masks, pixels, cols, rows); break;
+        case 1: blitBlock8<1>(x, y, row_masks, pixels, cols, rows); break;
+        case 2: blitBlock8<2>(x, y, row_masks, pixels, cols, rows); break;
+        case 3: blitBlock8<3>(x, y, row_masks, pixels, cols, rows); break;
+        case 4: blitBlock8<4>(x, y, row_masks, pixels, cols, rows); break;
+        case 5: blitBlock8<5>(x, y, row_masks, pixels, cols, rows); break;
+        case 6: blitBlock8<6>(x, y, row_masks, pixels, cols, rows); break;
+        case 7: blitBlock8<7>(x, y, row_masks, pixels, cols, rows); break;
+    }
+}
+
 void DisplayManager::setCursor(int16_t x, int16_t y) {
     if (matrix != nullptr) matrix->setCursor(x, y);
 }
@@ -103,17 +258,59 @@ void DisplayManager::setBrightness(uint8_t brightness) {
     // Map 0-255 to 0-60
     int hub75_brightness = (brightness * 60) / 255;
     
-    Serial.print("Setting brightness: Input=");
-    Serial.print(brightness);
-    Serial.print(" -> HUB75=");
-    Serial.println(hub75_brightness);
+    Log.print("Setting brightness: Input=");
+    Log.print(brightness);
+    Log.print(" -> HUB75=");
+    Log.println(hub75_brightness);
 
+    this->brightness = brightness;
+    master_brightness = hub75_brightness;
     hub75_set_masterbrightness(hub75_brightness);
     
     // Force update to apply new brightness bits to framebuffer
     update();
 }
 
+void DisplayManager::setBitPlanes(uint8_t planes) {
+    if (planes < 4) planes = 4;
+    if (planes > 8) planes = 8;
+    bit_planes = planes;
+    hub75_config(planes);
+    update();  // Driver framebuffer was cleared
+}
+
+uint32_t DisplayManager::getRefreshCount() {
+    return hub75_get_refresh_count();
+}
+
+void DisplayManager::setFade(uint8_t level) {
+    // Master brightness has only a few dozen steps, but costs nothing per pixel
+    hub75_set_masterbrightness((master_brightness * level + 127) / 255);
+}
+
+void DisplayManager::setRowWindow(int16_t y, int16_t x0, int16_t x1) {
+    hub75_set_row_window(y, x0, x1);
+}
+
+void DisplayManager::resetWindow() {
+    hub75_reset_window();
+}
+
+void DisplayManager::setScroll(int16_t y, int16_t h, int16_t offset) {
+    hub75_set_scroll(y, h, offset);
+}
+
 Adafruit_GFX* DisplayManager::getGFX() {
     return matrix;
 }
+
+uint32_t* DisplayManager::getBlockTarget(int16_t x, int16_t y, uint8_t w, uint8_t h) {
+    if (matrix == nullptr) return nullptr;
+    if (x < 0 || y < 0 || x + w > MATRIX_WIDTH || y + h > MATRIX_HEIGHT) return nullptr;
+    return matrix->getBuffer() + y * MATRIX_WIDTH + x;
+}
+
+const uint32_t* DisplayManager::getFrameBuffer() {
+    if (matrix == nullptr) return nullptr;
+    return matrix->getBuffer();
+}
@@ -7,9 +7,33 @@
 #include <Adafruit_GFX.h>
 #include "GFXMatrix.h"
 
+// 8x8 block transforms: optional transpose first, then flips. The bits
+// combine into all eight rotations/reflections of the block.
+enum BlockTransform : uint8_t {
+    XFORM_NONE      = 0,
+    XFORM_FLIP_H    = 1,                        // Mirror left/right
+    XFORM_FLIP_V    = 2,                        // Mirror top/bottom
+    XFORM_SWAP_XY   = 4,                        // Transpose (mirror on the main diagonal)
+    XFORM_ROT_180   = XFORM_FLIP_H | XFORM_FLIP_V,
+    XFORM_ROT_90    = XFORM_SWAP_XY | XFORM_FLIP_H,  // Clockwise
+    XFORM_ROT_270   = XFORM_SWAP_XY | XFORM_FLIP_V,
+    XFORM_COUNT     = 8
+};
+
 class DisplayManager {
 private:
     GFXMatrix* matrix;
+    uint8_t master_brightness;  // HUB75 master brightness (0-60) that a fade scales
+    uint8_t brightness;         // Last setBrightness() value (0-255)
+    uint8_t bit_planes;         // BCM bit planes the driver runs with
+
+    // Visible part of an 8-pixel span starting at pos on an axis of `limit`
+    // pixels, as a mask (bit 7 = first pixel)
+    static uint8_t clipMask8(int16_t pos, int16_t limit);
+
+    template <uint8_t T>
+    void blitBlock8(int16_t x, int16_t y, const uint8_t* row_masks, const uint32_t* pixels,
+                    uint8_t cols, uint8_t rows);
 
 public:
     DisplayManager();
@@ -19,7 +43,28 @@ public:
     void drawPixel(int16_t x, int16_t y, uint16_t color);
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    // Translucent drawing (alpha 0 = invisible, 255 = opaque)
+    // Rects are clipped once and blended span by span straight into the framebuffer
+    void blendPixel(int16_t x, int16_t y, uint16_t color, uint8_t alpha);
+    void blendRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t alpha);
+    void blendFrame(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t thickness,
+                    uint16_t color, uint8_t alpha);  // Hollow border, each pixel blended once
+
+    // Fill set bits of a 64-pixel row mask (bit 63 = pixel x) with one color
+    void drawRowMask(int16_t x, int16_t y, uint64_t mask, uint16_t color);
+
+    // Copy set bits of 8-pixel row masks (bit 7 = pixel x) from an 8-wide block
+    // of native colors (row-major, 8 per row), clipped once for the whole block.
+    // transform (BlockTransform) flips/rotates the cols x rows block (at most
+    // 8x8) in place while copying, so a mirrored sprite keeps its footprint.
+    void drawBlock8(int16_t x, int16_t y, const uint8_t* row_masks, const uint32_t* pixels,
+                    uint8_t cols, uint8_t rows, uint8_t transform = XFORM_NONE);
+
+    // Framebuffer color format (gamma-corrected 0x00RRGGBB)
+    static uint32_t toNativeColor(uint16_t color) { return GFXMatrix::LEDmx_565toRGB(color); }
     
+
     // Text support
     void setCursor(int16_t x, int16_t y);
     void setTextColor(uint16_t c);
@@ -29,9 +74,34 @@ public:
 
     void update();  // Refresh display
     void setBrightness(uint8_t brightness);
+    uint8_t getBrightness() const { return brightness; }
+
+    // Color depth vs refresh rate: 4-8 bit planes (restarts the driver)
+    void setBitPlanes(uint8_t planes);
+    uint8_t getBitPlanes() const { return bit_planes; }
+
+    // Full panel refreshes (all bit planes) since boot, counted by the driver
+    uint32_t getRefreshCount();
+
+    // Screen transitions, applied by the driver on the next update() - the
+    // framebuffer is left alone, so nothing needs redrawing for them
+    void setFade(uint8_t level);                            // 255 = set brightness, 0 = dark
+    void setRowWindow(int16_t y, int16_t x0, int16_t x1);   // Only columns [x0, x1) of row y lit
+    void resetWindow();                                     // Every row fully lit again
+
+    // Hardware-style vertical scroll of rows [y, y + h): the band is a ring and
+    // row y + s shows framebuffer row y + (s + offset) % h. h = 0 turns it off.
+    void setScroll(int16_t y, int16_t h, int16_t offset);
 
     // Access to underlying GFX object for advanced drawing
     Adafruit_GFX* getGFX();
+
+    // Framebuffer address of (x, y) if a w x h block there is entirely on screen,
+    // else nullptr - lets pre-clipped writers (compiled sprites) skip all checks
+    uint32_t* getBlockTarget(int16_t x, int16_t y, uint8_t w, uint8_t h);
+
+    // Native 0x00RRGGBB pixels, row-major MATRIX_WIDTH x MATRIX_HEIGHT (read-only)
+    const uint32_t* getFrameBuffer();
 };
 
 #endif // DISPLAY_MANAGER_H
@@ -0,0 +1,137 @@
+// display/frame_capture.cpp
+// Framebuffer snapshot encoder and chunked USB writer
+#include "frame_capture.h"
+#include "../serial_log.h"
+
+static const uint8_t FRAME_MAGIC[4] = {0xA5, 'F', 'R', 'M'};
+
+FrameCapture::FrameCapture() {
+    packet_len = 0;
+    sent = 0;
+    frame_no = 0;
+    capture_requested = false;
+    streaming = false;
+    last_stream_ms = 0;
+    encode_us = 0;
+    transfer_start_ms = 0;
+}
+
+void FrameCapture::toggleStream() {
+    streaming = !streaming;
+    Log.print("[CAPTURE] Stream ");
+    Log.println(streaming ? "on" : "off");
+}
+
+void FrameCapture::encode(const uint32_t* frame) {
+    uint32_t palette[256];
+    uint16_t palette_count = 0;
+    uint16_t run_count = 0;
+
+    // Runs are written first, palette is inserted in front once its size is known
+    uint8_t* runs = &packet[FRAME_CAPTURE_HEADER_BYTES + 256 * 3];
+    uint16_t pixels = MATRIX_WIDTH * MATRIX_HEIGHT;
+    uint16_t i = 0;
+
+    while (i < pixels) {
+        uint32_t color = frame[i] & 0x00FFFFFFu;
+        uint16_t len = 1;
+        while (i + len < pixels && len < 256 && (frame[i + len] & 0x00FFFFFFu) == color) {
+            len++;
+        }
+
+        // Palette lookup once per run, not per pixel (frames are mostly black)
+        uint16_t idx = 0;
+        while (idx < palette_count && palette[idx] != color) idx++;
+        if (idx == palette_count) {
+            if (palette_count < 256) {
+                palette[palette_count++] = color;
+            } else {
+                idx = 255;  // Palette full: lossy, reuse the last entry
+            }
+        }
+
+        runs[run_count * 2] = (uint8_t)(len - 1);
+        runs[run_count * 2 + 1] = (uint8_t)idx;
+        run_count++;
+        i += len;
+    }
+
+    uint8_t* p = packet;
+    memcpy(p, FRAME_MAGIC, 4);
+    p[4] = frame_no & 0xFF;
+    p[5] = frame_no >> 8;
+    p[6] = MATRIX_WIDTH;
+    p[7] = MATRIX_HEIGHT;
+    p[8] = (uint8_t)(palette_count - 1);
+    p[9] = run_count & 0xFF;
+    p[10] = run_count >> 8;
+    p += FRAME_CAPTURE_HEADER_BYTES;
+
+    for (uint16_t c = 0; c < palette_count; c++) {
+        *p++ = (palette[c] >> 16) & 0xFF;
+        *p++ = (palette[c] >> 8) & 0xFF;
+        *p++ = palette[c] & 0xFF;
+    }
+
+    // Close the gap between palette and runs
+    memmove(p, runs, run_count * 2);
+    p += run_count * 2;
+
+    uint8_t checksum = 0;
+    for (uint8_t* q = packet + 4; q < p; q++) checksum ^= *q;
+    *p++ = checksum;
+
+    packet_len = p - packet;
+    sent = 0;
+    frame_no++;
+}
+
+void FrameCapture::onFrameRendered(DisplayManager* display) {
+    if (isBusy()) return;  // Previous frame still draining
+
+    uint32_t now = millis();
+    bool stream_due = streaming && (now - last_stream_ms >= FRAME_STREAM_INTERVAL_MS);
+    if (!capture_requested && !stream_due) return;
+
+    const uint32_t* frame = display->getFrameBuffer();
+    if (frame == nullptr) return;
+
+    uint32_t start = micros();
+    encode(frame);
+    encode_us = micros() - start;
+
+    // Log text written mid-packet would corrupt it: hold it until service() is done
+    Log.hold();
+
+    capture_requested = false;
+    last_stream_ms = now;
+    transfer_start_ms = now;
+}
+
+void FrameCapture::service() {
+    if (!isBusy()) return;
+
+    int room = Serial.availableForWrite();
+    if (room <= 0) return;
+
+    uint16_t chunk = packet_len - sent;
+    if (chunk > (uint16_t)room) chunk = room;
+    Serial.write(&packet[sent], chunk);
+    sent += chunk;
+
+    if (!isBusy()) {
+        Serial.println();
+        Serial.print("[CAPTURE] Frame ");
+        Serial.print((int)(frame_no - 1));
+        Serial.print(": ");
+        Serial.print((int)packet_len);
+        Serial.print(" bytes (raw ");
+        Serial.print(MATRIX_WIDTH * MATRIX_HEIGHT * 3);
+        Serial.print("), encode ");
+        Serial.print((int)encode_us);
+        Serial.print(" us, transfer ");
+        Serial.print((int)(millis() - transfer_start_ms));
+        Serial.println(" ms");
+        Log.release();
+    }
+}
@@ -0,0 +1,59 @@
+// display/frame_capture.h
+// Framebuffer capture over USB CDC: palette + RLE compressed snapshots,
+// sent in small non-blocking chunks so loop() never stalls on Serial. Log
+// output goes through SerialLog, which holds it back while a packet is in flight
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "display_manager.h"
+
+// Wire format (little-endian), decoded by tools/decode_frames.py:
+//   magic     4 bytes  0xA5 'F' 'R' 'M'
+//   frame_no  u16
+//   width     u8
+//   height    u8
+//   palette   u8       entry count minus one (1..256 colors)
+//   run_count u16
+//   colors    3 bytes per palette entry (R, G, B as shown on the panel)
+//   runs      2 bytes per run: length minus one (1..256 pixels), palette index
+//   checksum  u8       XOR of every byte after the magic
+#define FRAME_CAPTURE_HEADER_BYTES 11
+#define FRAME_CAPTURE_MAX_BYTES    (FRAME_CAPTURE_HEADER_BYTES + 256 * 3 + \
+                                    MATRIX_WIDTH * MATRIX_HEIGHT * 2 + 1)
+
+class FrameCapture {
+private:
+    uint8_t packet[FRAME_CAPTURE_MAX_BYTES];
+    uint16_t packet_len;
+    uint16_t sent;             // Bytes of packet already written to Serial
+
+    uint16_t frame_no;
+    bool capture_requested;
+    bool streaming;
+    uint32_t last_stream_ms;
+
+    // Stats for the report line after each transfer
+    uint32_t encode_us;
+    uint32_t transfer_start_ms;
+
+    void encode(const uint32_t* frame);
+
+public:
+    FrameCapture();
+
+    void requestCapture() { capture_requested = true; }
+    void toggleStream();
+    bool isStreaming() const { return streaming; }
+    bool isBusy() const { return sent < packet_len; }
+
+    // Call right after a frame has been rendered: snapshots it if a capture
+    // is pending or the stream interval elapsed and no transfer is in flight
+    void onFrameRendered(DisplayManager* display);
+
+    // Call every loop pass: writes only what the USB TX buffer can take now
+    void service();
+};
+
+#endif // FRAME_CAPTURE_H
@@ -0,0 +1,105 @@
+// display/marquee.cpp
+// Marquee lane rendering and scrolling
+#include "marquee.h"
+
+// Adafruit_GFX target that rasterizes glyphs into a lane's 1bpp strip.
+// Lives on the stack only while a string is being rendered - no heap.
+class StripCanvas : public Adafruit_GFX {
+private:
+    uint8_t (*rows)[MARQUEE_STRIP_BYTES];
+
+public:
+    StripCanvas(uint8_t (*strip_rows)[MARQUEE_STRIP_BYTES], uint16_t w)
+        : Adafruit_GFX(w, MARQUEE_ROWS), rows(strip_rows) {}
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x < 0 || x >= WIDTH || y < 0 || y >= MARQUEE_ROWS || color == 0) {
+            return;
+        }
+        rows[y][x >> 3] |= (0x80 >> (x & 7));
+    }
+};
+
+Marquee::Marquee() {
+    clear();
+}
+
+void Marquee::clear() {
+    for (uint8_t i = 0; i < MARQUEE_MAX_LANES; i++) {
+        lanes[i].active = false;
+    }
+}
+
+bool Marquee::setLane(uint8_t lane, int16_t y, const char* text, uint16_t color, int16_t speed) {
+    if (lane >= MARQUEE_MAX_LANES) return false;
+    MarqueeLane& l = lanes[lane];
+
+    // Text plus a gap before it repeats, at least one screen wide so the
+    // 64-pixel window never wraps onto itself
+    uint16_t text_px = strlen(text) * 6;
+    uint16_t strip_px = (text_px + MARQUEE_GAP_PX + 7) & ~7;
+    if (strip_px < MATRIX_WIDTH) strip_px = MATRIX_WIDTH;
+    if (strip_px > MARQUEE_MAX_TEXT_PX) strip_px = MARQUEE_MAX_TEXT_PX;  // Truncates long text
+
+    memset(l.strip, 0, sizeof(l.strip));
+    StripCanvas canvas(l.strip, strip_px);
+    canvas.setTextWrap(false);
+    canvas.setTextSize(1);
+    canvas.setTextColor(1);
+    canvas.setCursor(0, 0);
+    canvas.print(text);
+
+    l.strip_px = strip_px;
+    l.y = y;
+    l.color = color;
+    l.speed = speed;
+    l.offset = 0;
+    l.active = true;
+    return true;
+}
+
+void Marquee::stopLane(uint8_t lane) {
+    if (lane < MARQUEE_MAX_LANES) lanes[lane].active = false;
+}
+
+void Marquee::update() {
+    for (uint8_t i = 0; i < MARQUEE_MAX_LANES; i++) {
+        MarqueeLane& l = lanes[i];
+        if (!l.active) continue;
+
+        int32_t period = (int32_t)l.strip_px << 8;
+        l.offset += l.speed;
+        if (l.offset >= period) l.offset -= period;
+        if (l.offset < 0) l.offset += period;
+    }
+}
+
+uint64_t Marquee::windowBits(const MarqueeLane& lane, uint8_t row, uint16_t px) const {
+    const uint8_t* bytes = lane.strip[row];
+    uint16_t nbytes = lane.strip_px >> 3;
+    uint16_t idx = px >> 3;
+    uint8_t bit = px & 7;
+
+    // Gather 9 bytes (wrapping) and align to the pixel offset; bit 63 = leftmost pixel
+    uint64_t w = 0;
+    for (uint8_t i = 0; i < 8; i++) {
+        w = (w << 8) | bytes[idx];
+        if (++idx == nbytes) idx = 0;
+    }
+    if (bit) {
+        w = (w << bit) | (bytes[idx] >> (8 - bit));
+    }
+    return w;
+}
+
+void Marquee::render(DisplayManager* display) {
+    for (uint8_t i = 0; i < MARQUEE_MAX_LANES; i++) {
+        const MarqueeLane& l = lanes[i];
+        if (!l.active) continue;
+
+        uint16_t px = (uint16_t)(l.offset >> 8);
+        for (uint8_t row = 0; row < MARQUEE_ROWS; row++) {
+            display->drawRowMask(0, l.y + row, windowBits(l, row, px), l.color);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// display/marquee.h
+// Scrolling text lanes: each string is rendered once into a 1bpp strip,
+// then every frame is just a windowed row copy at the current pixel offset
+#ifndef MARQUEE_H
+#define MARQUEE_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "display_manager.h"
+
+// Strip geometry: one 8-pixel text row (classic 6x8 font, text size 1)
+#define MARQUEE_ROWS         8
+#define MARQUEE_STRIP_BYTES  (MARQUEE_MAX_TEXT_PX / 8)
+
+struct MarqueeLane {
+    uint8_t strip[MARQUEE_ROWS][MARQUEE_STRIP_BYTES];  // MSB-first bits, wraps around
+    uint16_t strip_px;      // Text width + trailing gap, multiple of 8
+    int16_t y;              // Screen row of the lane's top edge
+    uint16_t color;         // RGB565
+    int16_t speed;          // Q8.8 pixels per frame (negative scrolls right)
+    int32_t offset;         // Q8.8 pixels into the strip
+    bool active;
+};
+
+class Marquee {
+private:
+    MarqueeLane lanes[MARQUEE_MAX_LANES];
+
+    uint64_t windowBits(const MarqueeLane& lane, uint8_t row, uint16_t px) const;
+
+public:
+    Marquee();
+    void clear();
+
+    // Render text into lane's strip (once); returns false if lane is out of range
+    bool setLane(uint8_t lane, int16_t y, const char* text, uint16_t color, int16_t speed);
+    void stopLane(uint8_t lane);
+
+    // Advance scroll offsets by one frame
+    void update();
+
+    // Copy each lane's visible 64-pixel window into the framebuffer
+    void render(DisplayManager* display);
+};
+
+#endif // MARQUEE_H
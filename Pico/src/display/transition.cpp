@@ -0,0 +1,104 @@
+// display/transition.cpp
+// Transition timing and the per-frame driver settings for each effect
+#include "transition.h"
+#include "../config.h"
+
+// Smallest iris radius (half pixels) that uncovers the corners of the panel
+#define IRIS_MAX_R   92
+
+static uint16_t isqrt(uint32_t v) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 14;   // v < 2^16 here
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+Transition::Transition() {
+    style = { TRANSITION_CUT, 0, 0 };
+    start_ms = 0;
+    active = false;
+    dirty = false;
+}
+
+void Transition::start(const TransitionStyle& s, uint32_t now) {
+    style = s;
+    start_ms = now;
+    active = s.type != TRANSITION_CUT && (s.out_ms + s.in_ms) > 0;
+}
+
+bool Transition::isOutgoing(uint32_t now) const {
+    return active && (now - start_ms) < style.out_ms;
+}
+
+void Transition::apply(DisplayManager* display, uint32_t now) {
+    if (!active) {
+        if (dirty) restore(display);
+        return;
+    }
+
+    uint32_t elapsed = now - start_ms;
+    if (elapsed < style.out_ms) {
+        applyLevel(display, 255 - (elapsed * 255) / style.out_ms, true);
+    } else if (elapsed - style.out_ms < style.in_ms) {
+        applyLevel(display, ((elapsed - style.out_ms) * 255) / style.in_ms, false);
+    } else {
+        active = false;
+        restore(display);
+    }
+}
+
+void Transition::applyLevel(DisplayManager* display, uint8_t level, bool outgoing) {
+    dirty = true;
+    switch (style.type) {
+        case TRANSITION_FADE:
+            display->setFade(level);
+            break;
+
+        case TRANSITION_WIPE: {
+            // Leaving: lit part shrinks towards the right; arriving: grows from the left
+            int16_t edge = (int16_t)((level * MATRIX_WIDTH) / 255);
+            int16_t x0 = outgoing ? MATRIX_WIDTH - edge : 0;
+            int16_t x1 = outgoing ? MATRIX_WIDTH : edge;
+            for (int16_t y = 0; y < MATRIX_HEIGHT; y++) {
+                display->setRowWindow(y, x0, x1);
+            }
+            break;
+        }
+
+        case TRANSITION_IRIS: {
+            // Circle centred on the panel, in half-pixel units so the centre
+            // falls between the middle rows/columns
+            int32_t r = (level * IRIS_MAX_R) / 255;
+            for (int16_t y = 0; y < MATRIX_HEIGHT; y++) {
+                int32_t dy = 2 * y + 1 - MATRIX_HEIGHT;
+                int32_t span = r * r - dy * dy;
+                if (span <= 0) {
+                    display->setRowWindow(y, 0, 0);
+                    continue;
+                }
+                int16_t half = isqrt(span);     // Half-pixels either side of centre
+                int16_t x0 = (MATRIX_WIDTH - half + 1) / 2;
+                display->setRowWindow(y, x0, MATRIX_WIDTH - x0);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void Transition::restore(DisplayManager* display) {
+    display->setFade(255);
+    display->resetWindow();
+    dirty = false;
+}
@@ -0,0 +1,52 @@
+// display/transition.h
+// Screen transitions between game states. Nothing is composited: the old
+// screen keeps rendering until the midpoint, then the new one takes over, and
+// the effect itself is applied by the HUB75 driver (master brightness for
+// fades, per-row visible windows for wipes and irises).
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+#include "display_manager.h"
+
+enum TransitionType : uint8_t {
+    TRANSITION_CUT,     // Instant switch
+    TRANSITION_FADE,    // Fade to black, then back up
+    TRANSITION_WIPE,    // Dark edge sweeps left to right across both screens
+    TRANSITION_IRIS     // Circle closes on the old screen, opens on the new one
+};
+
+// How one state change looks; either half may be 0 ms
+struct TransitionStyle {
+    uint8_t type;       // TransitionType
+    uint16_t out_ms;    // Old screen leaving
+    uint16_t in_ms;     // New screen arriving
+};
+
+class Transition {
+private:
+    TransitionStyle style;
+    uint32_t start_ms;
+    bool active;
+    bool dirty;         // Driver fade/window state needs restoring
+
+    // level: 0 = fully hidden, 255 = fully shown
+    void applyLevel(DisplayManager* display, uint8_t level, bool outgoing);
+    void restore(DisplayManager* display);
+
+public:
+    Transition();
+
+    // Begin a transition now; a running one is replaced
+    void start(const TransitionStyle& s, uint32_t now);
+
+    bool isActive() const { return active; }
+
+    // True while the old screen should still be rendered
+    bool isOutgoing(uint32_t now) const;
+
+    // Once per rendered frame, before DisplayManager::update()
+    void apply(DisplayManager* display, uint32_t now);
+};
+
+#endif // TRANSITION_H
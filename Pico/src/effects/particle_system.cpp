@@ -0,0 +1,125 @@
+// effects/particle_system.cpp
+// Particle pool implementation
+#include "particle_system.h"
+
+// sin() of 16 evenly spaced angles, Q8 (cos(k) = sin(k + 4))
+static const int16_t SIN16_Q8[16] = {
+    0, 98, 181, 237, 256, 237, 181, 98,
+    0, -98, -181, -237, -256, -237, -181, -98
+};
+
+static const uint16_t CONFETTI_COLORS[] = {
+    0xF800, 0xFD20, 0xFFE0, 0x07E0, 0x07FF, 0x001F, 0xF81F, 0xFFFF
+};
+
+// Particles are dropped once they leave the screen by more than this margin
+static const int16_t OFFSCREEN_MARGIN = 4;
+
+// Fade over the last frames of life
+static const uint8_t FADE_FRAMES = 16;
+
+ParticleSystem::ParticleSystem() {
+    count = 0;
+    rng_state = 0x9E3779B9u;
+}
+
+void ParticleSystem::clear() {
+    count = 0;
+}
+
+uint32_t ParticleSystem::nextRandom() {
+    // xorshift32: cheap and allocation-free, visuals only
+    uint32_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rng_state = x;
+    return x;
+}
+
+void ParticleSystem::spawn(int16_t x, int16_t y, int16_t vx, int16_t vy, int8_t ay,
+                           uint8_t frames, uint16_t c) {
+    if (count >= PARTICLE_CAPACITY) return;  // Pool full: drop, never allocate
+
+    uint16_t i = count++;
+    pos_x[i] = x * 256;
+    pos_y[i] = y * 256;
+    vel_x[i] = vx;
+    vel_y[i] = vy;
+    accel_y[i] = ay;
+    life[i] = frames;
+    color[i] = c;
+}
+
+void ParticleSystem::emitBurst(int16_t x, int16_t y, uint8_t n, uint16_t c) {
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t r = nextRandom();
+        uint8_t angle = r & 0x0F;
+        int16_t speed = 96 + ((r >> 4) & 0x7F);         // 0.4..0.9 px/frame
+        int16_t vx = (SIN16_Q8[(angle + 4) & 0x0F] * speed) >> 8;
+        int16_t vy = (SIN16_Q8[angle] * speed) >> 8;
+        spawn(x, y, vx, vy, 2, 24 + ((r >> 11) & 0x0F), c);
+    }
+}
+
+void ParticleSystem::emitSparks(int16_t x, int16_t y, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t r = nextRandom();
+        int16_t vx = (int16_t)((r & 0x1FF) - 256);     // -1..1 px/frame
+        int16_t vy = -(int16_t)(192 + ((r >> 9) & 0xFF)); // Upwards 0.75..1.75 px/frame
+        uint16_t c = (r & 0x10000) ? 0xFFE0 : 0xFFFF;    // Yellow / white
+        spawn(x, y, vx, vy, 24, 16 + ((r >> 17) & 0x0F), c);
+    }
+}
+
+void ParticleSystem::emitConfetti(int16_t x0, int16_t x1, uint8_t n) {
+    int16_t span = (x1 > x0) ? (x1 - x0) : 1;
+    for (uint8_t i = 0; i < n; i++) {
+        uint32_t r = nextRandom();
+        int16_t x = x0 + (int16_t)(r % span);
+        int16_t vx = (int16_t)(((r >> 8) & 0x3F) - 32);   // Slight sideways drift
+        int16_t vy = 48 + ((r >> 14) & 0x3F);              // 0.2..0.45 px/frame down
+        uint16_t c = CONFETTI_COLORS[(r >> 20) & 0x07];
+        spawn(x, -1, vx, vy, 0, 160, c);
+    }
+}
+
+void ParticleSystem::update() {
+    uint16_t i = 0;
+    while (i < count) {
+        vel_y[i] += accel_y[i];
+        pos_x[i] += vel_x[i];
+        pos_y[i] += vel_y[i];
+
+        int16_t px = pos_x[i] >> 8;
+        int16_t py = pos_y[i] >> 8;
+        bool offscreen = px < -OFFSCREEN_MARGIN || px >= MATRIX_WIDTH + OFFSCREEN_MARGIN ||
+                         py < -OFFSCREEN_MARGIN || py >= MATRIX_HEIGHT + OFFSCREEN_MARGIN;
+
+        if (--life[i] == 0 || offscreen) {
+            // Swap-remove: move the last live particle into this slot
+            uint16_t last = --count;
+            pos_x[i] = pos_x[last];
+            pos_y[i] = pos_y[last];
+            vel_x[i] = vel_x[last];
+            vel_y[i] = vel_y[last];
+            accel_y[i] = accel_y[last];
+            life[i] = life[last];
+            color[i] = color[last];
+            continue;  // Re-examine the moved particle
+        }
+        i++;
+    }
+}
+
+void ParticleSystem::render(DisplayManager* display) {
+    for (uint16_t i = 0; i < count; i++) {
+        int16_t px = pos_x[i] >> 8;
+        int16_t py = pos_y[i] >> 8;
+        if (life[i] >= FADE_FRAMES) {
+            display->drawPixel(px, py, color[i]);
+        } else {
+            display->blendPixel(px, py, color[i], life[i] * (256 / FADE_FRAMES));
+        }
+    }
+}
@@ -0,0 +1,51 @@
+// effects/particle_system.h
+// Fixed-capacity particle pool (bursts, sparks, confetti) with fixed-point physics
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "../display/display_manager.h"
+
+// Structure-of-arrays pool: no heap, dead particles are swapped with the last
+// live one so update/render always walk a dense prefix
+class ParticleSystem {
+private:
+    int16_t pos_x[PARTICLE_CAPACITY];    // Q8.8 pixels
+    int16_t pos_y[PARTICLE_CAPACITY];
+    int16_t vel_x[PARTICLE_CAPACITY];    // Q8.8 pixels per frame
+    int16_t vel_y[PARTICLE_CAPACITY];
+    int8_t  accel_y[PARTICLE_CAPACITY];  // Q8.8 pixels per frame^2 (gravity / drift)
+    uint8_t life[PARTICLE_CAPACITY];     // Frames left
+    uint16_t color[PARTICLE_CAPACITY];   // RGB565
+    uint16_t count;
+
+    uint32_t rng_state;
+
+    uint32_t nextRandom();
+    void spawn(int16_t x, int16_t y, int16_t vx, int16_t vy, int8_t ay,
+               uint8_t frames, uint16_t c);
+
+public:
+    ParticleSystem();
+    void clear();
+
+    // Radial burst around a pixel position
+    void emitBurst(int16_t x, int16_t y, uint8_t n, uint16_t c);
+
+    // Fast, short-lived sparks that fall under gravity
+    void emitSparks(int16_t x, int16_t y, uint8_t n);
+
+    // Multicolored flakes drifting down from the top edge between x0 and x1
+    void emitConfetti(int16_t x0, int16_t x1, uint8_t n);
+
+    // Advance one frame of physics (call once per rendered frame)
+    void update();
+
+    // Draw live particles, fading out over their last frames
+    void render(DisplayManager* display);
+
+    uint16_t getActiveCount() const { return count; }
+};
+
+#endif // PARTICLE_SYSTEM_H
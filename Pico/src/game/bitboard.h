@@ -0,0 +1,220 @@
+// game/bitboard.h
+// Cell sets as bitboards, bit (y * W + x). A W x H board is ceil(W*H / 64)
+// words; the 8x7 game grid is a single uint64_t with the same layout as
+// EntityPool's cell masks. A step in a direction is a shift (1 for east/west,
+// W for north/south), so flood fills and distance rings advance a whole
+// frontier per step instead of visiting cells one by one.
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "maze_grid.h"
+
+template <uint16_t W, uint16_t H>
+class BitBoard {
+public:
+    static constexpr uint32_t CELLS = (uint32_t)W * H;
+    static constexpr uint32_t WORDS = (CELLS + 63) / 64;
+
+    uint64_t w[WORDS];
+
+    constexpr BitBoard() : w{} {}
+
+    static constexpr BitBoard cell(uint32_t i) {
+        BitBoard b;
+        b.set(i);
+        return b;
+    }
+
+    static constexpr BitBoard all() {
+        BitBoard b;
+        for (uint32_t i = 0; i < WORDS; i++) b.w[i] = ~0ULL;
+        if (CELLS & 63) b.w[WORDS - 1] = (1ULL << (CELLS & 63)) - 1;
+        return b;
+    }
+
+    static constexpr BitBoard column(uint16_t x) {
+        BitBoard b;
+        for (uint16_t y = 0; y < H; y++) b.set((uint32_t)y * W + x);
+        return b;
+    }
+
+    static constexpr BitBoard row(uint16_t y) {
+        BitBoard b;
+        for (uint16_t x = 0; x < W; x++) b.set((uint32_t)y * W + x);
+        return b;
+    }
+
+    // Border masks: cells that have a neighbour in `dir` (NORTH..WEST)
+    static constexpr BitBoard canStep(uint8_t dir) {
+        return dir == 0 ? all().andNot(row(0)) :
+               dir == 1 ? all().andNot(column(W - 1)) :
+               dir == 2 ? all().andNot(row(H - 1)) :
+                          all().andNot(column(0));
+    }
+
+    constexpr bool test(uint32_t i) const { return (w[i >> 6] >> (i & 63)) & 1; }
+    constexpr void set(uint32_t i) { w[i >> 6] |= 1ULL << (i & 63); }
+    constexpr void reset(uint32_t i) { w[i >> 6] &= ~(1ULL << (i & 63)); }
+
+    constexpr BitBoard operator|(const BitBoard& o) const { BitBoard b; for (uint32_t i = 0; i < WORDS; i++) b.w[i] = w[i] | o.w[i]; return b; }
+    constexpr BitBoard operator&(const BitBoard& o) const { BitBoard b; for (uint32_t i = 0; i < WORDS; i++) b.w[i] = w[i] & o.w[i]; return b; }
+    constexpr BitBoard andNot(const BitBoard& o) const { BitBoard b; for (uint32_t i = 0; i < WORDS; i++) b.w[i] = w[i] & ~o.w[i]; return b; }
+    constexpr BitBoard& operator|=(const BitBoard& o) { for (uint32_t i = 0; i < WORDS; i++) w[i] |= o.w[i]; return *this; }
+    constexpr BitBoard& operator&=(const BitBoard& o) { for (uint32_t i = 0; i < WORDS; i++) w[i] &= o.w[i]; return *this; }
+
+    constexpr bool operator==(const BitBoard& o) const {
+        for (uint32_t i = 0; i < WORDS; i++) if (w[i] != o.w[i]) return false;
+        return true;
+    }
+    constexpr bool operator!=(const BitBoard& o) const { return !(*this == o); }
+
+    constexpr bool any() const {
+        for (uint32_t i = 0; i < WORDS; i++) if (w[i]) return true;
+        return false;
+    }
+
+    uint32_t count() const {
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < WORDS; i++) n += __builtin_popcountll(w[i]);
+        return n;
+    }
+
+    // Lowest set cell, or CELLS if empty
+    uint32_t first() const {
+        for (uint32_t i = 0; i < WORDS; i++) {
+            if (w[i]) return i * 64 + __builtin_ctzll(w[i]);
+        }
+        return CELLS;
+    }
+
+    // Every cell index moved up / down by k (bits past the board are dropped)
+    constexpr BitBoard shiftedUp(uint32_t k) const {
+        BitBoard b;
+        uint32_t q = k >> 6, r = k & 63;
+        for (uint32_t i = WORDS; i-- > q;) {
+            b.w[i] = w[i - q] << r;
+            if (r && i > q) b.w[i] |= w[i - q - 1] >> (64 - r);
+        }
+        if (CELLS & 63) b.w[WORDS - 1] &= (1ULL << (CELLS & 63)) - 1;
+        return b;
+    }
+
+    constexpr BitBoard shiftedDown(uint32_t k) const {
+        BitBoard b;
+        uint32_t q = k >> 6, r = k & 63;
+        for (uint32_t i = 0; i + q < WORDS; i++) {
+            b.w[i] = w[i + q] >> r;
+            if (r && i + q + 1 < WORDS) b.w[i] |= w[i + q + 1] << (64 - r);
+        }
+        return b;
+    }
+
+    // Neighbours in `dir` of the cells in this set that lie inside canStep(dir)
+    // - callers that already masked by a passage board skip the border check
+    constexpr BitBoard stepInside(uint8_t dir) const {
+        return dir == 0 ? shiftedDown(W) :
+               dir == 1 ? shiftedUp(1) :
+               dir == 2 ? shiftedUp(W) :
+                          shiftedDown(1);
+    }
+
+    constexpr BitBoard step(uint8_t dir) const { return (*this & canStep(dir)).stepInside(dir); }
+};
+
+typedef BitBoard<MAZE_WIDTH, MAZE_HEIGHT> MazeBits;
+
+// Border masks of the game grid, folded at compile time
+static constexpr MazeBits MAZE_CAN_STEP[4] = {
+    MazeBits::canStep(0), MazeBits::canStep(1), MazeBits::canStep(2), MazeBits::canStep(3)
+};
+
+// open[d]: cells with a passage in direction d (NORTH..WEST), from a WallGrid
+// of the same size
+template <uint16_t W, uint16_t H>
+void loadPassages(const WallGrid& grid, BitBoard<W, H> open[4]) {
+    for (uint8_t d = 0; d < 4; d++) open[d] = BitBoard<W, H>();
+    for (uint16_t y = 0; y < H; y++) {
+        for (uint16_t x = 0; x < W; x++) {
+            uint8_t dirs = grid.openings(x, y);
+            uint32_t i = (uint32_t)y * W + x;
+            for (uint8_t d = 0; d < 4; d++) {
+                if (dirs & (1 << d)) open[d].set(i);
+            }
+        }
+    }
+}
+
+// Flood fill from `from` through open[]: one shift-and-mask step per distance.
+// rings[n] (if given, up to max_rings) gets the cells exactly n moves away;
+// *reached gets every reachable cell. Returns the number of rings (farthest
+// distance + 1).
+//
+// Multi-word boards step only the words around the frontier (a move reaches
+// at most W/64 + 1 words away), so a long corridor in a big maze costs a few
+// words per ring rather than the whole board.
+template <uint16_t W, uint16_t H>
+uint32_t floodFill(const BitBoard<W, H> open[4], const BitBoard<W, H>& from, BitBoard<W, H>* reached,
+                   BitBoard<W, H>* rings = nullptr, uint32_t max_rings = 0) {
+    typedef BitBoard<W, H> Board;
+    Board seen = from;
+    Board frontier = from;
+    uint32_t n = 0;
+
+    if (Board::WORDS == 1) {
+        while (frontier.any()) {
+            if (rings && n < max_rings) rings[n] = frontier;
+            n++;
+            Board next = (frontier & open[0]).stepInside(0);
+            next |= (frontier & open[1]).stepInside(1);
+            next |= (frontier & open[2]).stepInside(2);
+            next |= (frontier & open[3]).stepInside(3);
+            frontier = next.andNot(seen);
+            seen |= frontier;
+        }
+        if (reached) *reached = seen;
+        return n;
+    }
+
+    const int32_t q = W >> 6, r = W & 63;
+    const int32_t last = Board::WORDS - 1;
+    int32_t lo = 0, hi = last;                 // Words the frontier may occupy
+    uint64_t next[Board::WORDS];
+    while (true) {
+        while (lo <= hi && frontier.w[lo] == 0) lo++;
+        while (hi >= lo && frontier.w[hi] == 0) hi--;
+        if (lo > hi) break;
+        if (rings && n < max_rings) rings[n] = frontier;
+        n++;
+
+        // Frontier cells that can leave in direction d, word j (0 outside)
+        auto moving = [&](uint8_t d, int32_t j) -> uint64_t {
+            return (j >= lo && j <= hi) ? frontier.w[j] & open[d].w[j] : 0;
+        };
+        int32_t a = lo - q - 1 < 0 ? 0 : lo - q - 1;
+        int32_t b = hi + q + 1 > last ? last : hi + q + 1;
+        for (int32_t j = a; j <= b; j++) {
+            uint64_t v = (moving(1, j) << 1) | (moving(1, j - 1) >> 63) |      // East
+                         (moving(3, j) >> 1) | (moving(3, j + 1) << 63);       // West
+            if (r) {
+                v |= (moving(2, j - q) << r) | (moving(2, j - q - 1) >> (64 - r));   // South
+                v |= (moving(0, j + q) >> r) | (moving(0, j + q + 1) << (64 - r));   // North
+            } else {
+                v |= moving(2, j - q) | moving(0, j + q);
+            }
+            next[j] = v & ~seen.w[j];
+        }
+        for (int32_t j = lo; j <= hi; j++) frontier.w[j] = 0;
+        for (int32_t j = a; j <= b; j++) {
+            frontier.w[j] = next[j];
+            seen.w[j] |= next[j];
+        }
+        lo = a;
+        hi = b;
+    }
+    if (reached) *reached = seen;
+    return n;
+}
+
+#endif // BITBOARD_H
@@ -0,0 +1,136 @@
+// game/entities.cpp
+// Entity pool implementation
+#include "entities.h"
+#include "../sprites/item_sprites.h"
+#include "../sprites/sprite_cache.h"
+
+static_assert(MAZE_CELLS <= 64, "cell bitmaps are one uint64_t");
+
+static const SpriteDefinition* const ENTITY_SPRITES[ENTITY_TYPE_COUNT] = {
+    &KEY_SPRITE, &TRAP_SPRITE, &HAZARD_SPRITE
+};
+
+EntityPool::EntityPool() {
+    step_ms = HAZARD_STEP_MS;
+    clear();
+}
+
+void EntityPool::clear() {
+    count = 0;
+    occupied = 0;
+    for (uint8_t t = 0; t < ENTITY_TYPE_COUNT; t++) cells_by_type[t] = 0;
+    memset(cell_entity, ENTITY_NONE, sizeof(cell_entity));
+    next_step_ms = millis() + step_ms;
+}
+
+void EntityPool::place(uint8_t slot, uint8_t x, uint8_t y) {
+    uint64_t bit = cellBit(x, y);
+    cell_x[slot] = x;
+    cell_y[slot] = y;
+    occupied |= bit;
+    cells_by_type[type[slot]] |= bit;
+    cell_entity[cellIndex(x, y)] = slot;
+}
+
+void EntityPool::unplace(uint8_t slot) {
+    uint64_t bit = cellBit(cell_x[slot], cell_y[slot]);
+    occupied &= ~bit;
+    cells_by_type[type[slot]] &= ~bit;
+    cell_entity[cellIndex(cell_x[slot], cell_y[slot])] = ENTITY_NONE;
+}
+
+uint8_t EntityPool::spawn(EntityType t, uint8_t x, uint8_t y) {
+    if (count >= ENTITY_CAPACITY || x >= MAZE_WIDTH || y >= MAZE_HEIGHT) return ENTITY_NONE;
+    if (isOccupied(x, y)) return ENTITY_NONE;
+
+    uint8_t slot = count++;
+    type[slot] = t;
+    heading[slot] = random(0, 4);
+    place(slot, x, y);
+    SpriteRenderer::initInstance(&sprite[slot], ENTITY_SPRITES[t]);
+    Motion::snapTo(&motion[slot], x * CELL_SIZE, y * CELL_SIZE + MAZE_OFFSET_Y);
+    return slot;
+}
+
+uint8_t EntityPool::spawnRandom(EntityType t, uint64_t avoid) {
+    uint64_t taken = avoid | occupied;
+    uint8_t free_cells = MAZE_CELLS - __builtin_popcountll(taken & ((1ULL << MAZE_CELLS) - 1));
+    if (free_cells == 0) return ENTITY_NONE;
+
+    // Pick the n-th free cell directly instead of retrying random cells
+    uint8_t n = random(0, free_cells);
+    for (uint8_t cell = 0; cell < MAZE_CELLS; cell++) {
+        if (taken & (1ULL << cell)) continue;
+        if (n-- == 0) return spawn(t, cell % MAZE_WIDTH, cell / MAZE_WIDTH);
+    }
+    return ENTITY_NONE;
+}
+
+void EntityPool::remove(uint8_t slot) {
+    if (slot >= count) return;
+    unplace(slot);
+
+    // Swap the last live entity into the hole and repoint its cell
+    uint8_t last = --count;
+    if (slot != last) {
+        type[slot] = type[last];
+        cell_x[slot] = cell_x[last];
+        cell_y[slot] = cell_y[last];
+        heading[slot] = heading[last];
+        sprite[slot] = sprite[last];
+        motion[slot] = motion[last];
+        cell_entity[cellIndex(cell_x[slot], cell_y[slot])] = slot;
+    }
+}
+
+void EntityPool::stepHazard(uint8_t slot, uint64_t blocked, const MazeBits* passages, uint32_t now) {
+    static const int8_t DX[4] = { 0, 1, 0, -1 };
+    static const int8_t DY[4] = { -1, 0, 1, 0 };
+
+    // Try ahead, then turn around; stay put if both are closed
+    for (uint8_t attempt = 0; attempt < 2; attempt++) {
+        uint8_t d = heading[slot];
+        uint8_t nx = cell_x[slot] + DX[d];
+        uint8_t ny = cell_y[slot] + DY[d];
+        if (passages[d].test(cellIndex(cell_x[slot], cell_y[slot])) &&
+            !((blocked | occupied) & cellBit(nx, ny))) {
+            unplace(slot);
+            place(slot, nx, ny);
+            Motion::moveTo(&motion[slot], nx * CELL_SIZE, ny * CELL_SIZE + MAZE_OFFSET_Y,
+                           MOVE_TWEEN_MS, EASE_IN_OUT, now);
+            return;
+        }
+        heading[slot] = (d + 2) & 3;
+    }
+}
+
+void EntityPool::update(uint32_t now, uint64_t blocked, const MazeBits* passages) {
+    if ((int32_t)(now - next_step_ms) < 0) return;
+    next_step_ms += step_ms;
+    if ((int32_t)(now - next_step_ms) >= 0) next_step_ms = now + step_ms;  // Fell behind
+
+    if (cells_by_type[ENTITY_HAZARD] == 0) return;
+    for (uint8_t i = 0; i < count; i++) {
+        if (type[i] == ENTITY_HAZARD) stepHazard(i, blocked, passages, now);
+    }
+}
+
+uint8_t EntityPool::collectSprites(SpriteInstance** out, uint8_t max) {
+    uint8_t n = (count < max) ? count : max;
+    for (uint8_t i = 0; i < n; i++) out[i] = &sprite[i];
+    return n;
+}
+
+void EntityPool::submit(SpriteBatch* batch, uint32_t now) {
+    for (uint8_t i = 0; i < count; i++) {
+        int16_t px, py;
+        Motion::getPosition(&motion[i], now, &px, &py);
+        batch->submit(&sprite[i], px, py, Z_ITEM);
+    }
+}
+
+void EntityPool::prewarm() {
+    for (uint8_t t = 0; t < ENTITY_TYPE_COUNT; t++) {
+        SpriteCache::prewarm(ENTITY_SPRITES[t], SPRITE_CACHE_NO_TINT);
+    }
+}
@@ -0,0 +1,94 @@
+// game/entities.h
+// Maze items and hazards: fixed-capacity SoA pool plus cell occupancy bitmaps,
+// so "what is in this cell" is a bit test and a table lookup, never a scan
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "maze_generator.h"
+#include "motion.h"
+#include "../sprites/sprite.h"
+#include "../sprites/sprite_batch.h"
+
+#define ENTITY_NONE  0xFF
+
+enum EntityType : uint8_t {
+    ENTITY_KEY,        // Picked up on entry; opens one closed exit later
+    ENTITY_TRAP,       // Sprung on entry; the player sits out their next turn
+    ENTITY_HAZARD,     // Patrols the grid and blocks the cell it stands on
+    ENTITY_TYPE_COUNT
+};
+
+// Structure-of-arrays pool like ParticleSystem: removed entities are swapped
+// with the last live one, so every walk covers a dense prefix
+class EntityPool {
+private:
+    uint8_t type[ENTITY_CAPACITY];
+    uint8_t cell_x[ENTITY_CAPACITY];
+    uint8_t cell_y[ENTITY_CAPACITY];
+    uint8_t heading[ENTITY_CAPACITY];          // Direction, hazards only
+    SpriteInstance sprite[ENTITY_CAPACITY];
+    MotionTween motion[ENTITY_CAPACITY];
+    uint8_t count;
+
+    // Bit (y * MAZE_WIDTH + x) set when a cell holds an entity of that type
+    uint64_t cells_by_type[ENTITY_TYPE_COUNT];
+    uint64_t occupied;
+    uint8_t cell_entity[MAZE_CELLS];           // Cell -> pool slot, ENTITY_NONE if empty
+
+    uint32_t next_step_ms;                     // Hazards all step together
+    uint16_t step_ms;                          // Hazard step interval
+
+    void place(uint8_t slot, uint8_t x, uint8_t y);
+    void unplace(uint8_t slot);
+    void stepHazard(uint8_t slot, uint64_t blocked, const MazeBits* passages, uint32_t now);
+
+public:
+    EntityPool();
+    void clear();
+
+    static uint8_t cellIndex(uint8_t x, uint8_t y) { return y * MAZE_WIDTH + x; }
+    static uint64_t cellBit(uint8_t x, uint8_t y) { return 1ULL << cellIndex(x, y); }
+
+    // Add an entity on a free cell; returns its slot or ENTITY_NONE if the cell
+    // is taken or the pool is full. Slots change when others are removed.
+    uint8_t spawn(EntityType t, uint8_t x, uint8_t y);
+
+    // Spawn on a random cell outside `avoid` (and not already occupied)
+    uint8_t spawnRandom(EntityType t, uint64_t avoid);
+
+    void remove(uint8_t slot);
+
+    // O(1) cell queries
+    uint8_t at(uint8_t x, uint8_t y) const { return cell_entity[cellIndex(x, y)]; }
+    bool has(EntityType t, uint8_t x, uint8_t y) const { return cells_by_type[t] & cellBit(x, y); }
+    bool isOccupied(uint8_t x, uint8_t y) const { return occupied & cellBit(x, y); }
+    uint64_t getOccupied() const { return occupied; }
+
+    EntityType getType(uint8_t slot) const { return (EntityType)type[slot]; }
+    uint8_t getX(uint8_t slot) const { return cell_x[slot]; }
+    uint8_t getY(uint8_t slot) const { return cell_y[slot]; }
+    uint8_t getCount() const { return count; }
+
+    void setStepMs(uint16_t ms) { step_ms = ms; }
+    uint16_t getStepMs() const { return step_ms; }
+
+    // Move hazards once every step_ms along `passages` (MazeGenerator's boards,
+    // so never through a carved wall); they never enter `blocked` cells
+    // (players, goal) or other entities and turn around instead
+    void update(uint32_t now, uint64_t blocked, const MazeBits* passages);
+
+    // Append live sprite instances for the shared animation tick; returns how many
+    uint8_t collectSprites(SpriteInstance** out, uint8_t max);
+
+    // Queue every entity's sprite at its (tweened) position
+    void submit(SpriteBatch* batch, uint32_t now);
+
+    // Decode every item frame into the sprite cache ahead of play. Lives here
+    // because the generated sprite tables are per translation unit: only this
+    // file's copies are the ones submit() draws (and the cache is keyed by)
+    static void prewarm();
+};
+
+#endif // ENTITIES_H
@@ -3,18 +3,47 @@
 #include "../config.h"
 #include "../sprites/player_sprites.h"
 #include "../sprites/goal_sprites.h"
+#include "../sprites/sprite_cache.h"
+#include "../serial_log.h"
+
+// Transition for each state change, indexed [from][to]
+static const TransitionStyle TRANSITIONS[STATE_WIN + 1][STATE_WIN + 1] = {
+    // from STATE_START
+    { TRANSITION_TO_START, TRANSITION_START_TO_PLAYING, {}, TRANSITION_TO_WIN },
+    // from STATE_PLAYING
+    { TRANSITION_TO_START, {}, TRANSITION_PLAYING_TO_GOAL, TRANSITION_TO_WIN },
+    // from STATE_GOAL_MESSAGE
+    { TRANSITION_TO_START, TRANSITION_GOAL_TO_PLAYING, {}, TRANSITION_TO_WIN },
+    // from STATE_WIN
+    { TRANSITION_TO_START, {}, {}, {} },
+};
 
 GameState::GameState() {
     active_player = 0;
     winner = 0;
     state = STATE_START;
+    outgoing_scene = STATE_START;
     lastMoveResult = MOVE_NONE;
     goalMessageStart = 0;
+    pending_move = DIR_NONE;
+    plans_ready = false;
+    speculate = MOVE_SPECULATE;
+    last_move_prepared = false;
+    move_epoch = 0;
+
+    // Sprites are ticked from boot, before the first round sets them up
+    SpriteRenderer::initInstance(&players[0].sprite, &PLAYER1_SPRITE);
+    SpriteRenderer::initInstance(&players[1].sprite, &PLAYER2_SPRITE);
+    SpriteRenderer::initInstance(&goal_sprite, &GOAL_SPRITE);
 }
 
 void GameState::init() {
-    state = STATE_START;
+    changeState(STATE_START);
     lastMoveResult = MOVE_NONE;  // Clear any stale move result
+    pending_move = DIR_NONE;     // A new round replaces whatever it would have done
+    particles.clear();
+    marquee.clear();
+    backdrop.init((uint32_t)random());
 }
 
 uint8_t GameState::getActivePlayer() {
@@ -28,25 +57,26 @@ uint16_t GameState::getPlayerMoves(uint8_t player_id) {
 
 void GameState::resetGame() {
     #ifdef DEBUG_MODE
-    Serial.println("DEBUG: resetGame() started");
+    Log.println("DEBUG: resetGame() started");
     #endif
 
     // Initialize maze (clears grid)
     maze.init();
+    move_epoch++;   // Visit counts are reset; any prepared moves are stale
 
     #ifdef DEBUG_MODE
-    Serial.println("DEBUG: Picking player start position...");
+    Log.println("DEBUG: Picking player start position...");
     #endif
 
     // Randomize Start Position
     uint8_t sx = random(0, MAZE_WIDTH);
     uint8_t sy = random(0, MAZE_HEIGHT);
     #ifdef DEBUG_MODE
-    Serial.print("DEBUG: P1 start = (");
-    Serial.print(sx);
-    Serial.print(",");
-    Serial.print(sy);
-    Serial.println(")");
+    Log.print("DEBUG: P1 start = (");
+    Log.print(sx);
+    Log.print(",");
+    Log.print(sy);
+    Log.println(")");
     #endif
 
     // Initialize Player 1
@@ -54,137 +84,126 @@ void GameState::resetGame() {
     players[0].y = sy;
     players[0].color = PLAYER1_COLOR;
     players[0].moves = 0;
+    players[0].keys = 0;
+    players[0].trapped = false;
     SpriteRenderer::initInstance(&players[0].sprite, &PLAYER1_SPRITE);
+    Motion::snapTo(&players[0].motion, sx * CELL_SIZE, sy * CELL_SIZE + MAZE_OFFSET_Y);
 
     // Generate initial directions at start
-    maze.generateNewDirections(sx, sy);
+    maze.generateNewDirections(sx, sy, 0);
     players[0].current_cell_dirs = maze.getCurrentDirections();
     #ifdef DEBUG_MODE
-    Serial.println("DEBUG: P1 initialized");
+    Log.println("DEBUG: P1 initialized");
     #endif
 
-    // Initialize Player 2 at a different position
-    #ifdef DEBUG_MODE
-    Serial.println("DEBUG: Setting up Player 2...");
-    #endif
+    // Player 2 and the goal are placed by path distance (placement.h):
+    // O(1) picks from a flood fill, so the goal is always reachable
+    uint8_t p1_cell = EntityPool::cellIndex(sx, sy);
+    distances.build(maze, &p1_cell, 1, EntityPool::cellBit(sx, sy));
     uint8_t sx2, sy2;
-        int dist_sq_p2;
-        int p2_attempts = 0;
-        do {
-            sx2 = random(0, MAZE_WIDTH);
-            sy2 = random(0, MAZE_HEIGHT);
-
-            // Ensure some distance from Player 1
-            int dx = (int)sx - (int)sx2;
-            int dy = (int)sy - (int)sy2;
-            dist_sq_p2 = dx*dx + dy*dy;
-            p2_attempts++;
-            if (p2_attempts > 1000) {
-                #ifdef DEBUG_MODE
-                Serial.println("DEBUG: P2 placement timeout!");
-                #endif
-                break;
-            }
-        } while (dist_sq_p2 < 25); // Min distance 5 units
-
-        players[1].x = sx2;
-        players[1].y = sy2;
-        players[1].color = PLAYER2_COLOR;
-        players[1].moves = 0;
-        SpriteRenderer::initInstance(&players[1].sprite, &PLAYER2_SPRITE);
-
-        // Generate initial directions for Player 2
-        maze.generateNewDirections(sx2, sy2);
-        players[1].current_cell_dirs = maze.getCurrentDirections();
+    distances.pick(SPAWN_MIN_PATH_DIST, &sx2, &sy2);
+
+    players[1].x = sx2;
+    players[1].y = sy2;
+    players[1].color = PLAYER2_COLOR;
+    players[1].moves = 0;
+    players[1].keys = 0;
+    players[1].trapped = false;
+    SpriteRenderer::initInstance(&players[1].sprite, &PLAYER2_SPRITE);
+    Motion::snapTo(&players[1].motion, sx2 * CELL_SIZE, sy2 * CELL_SIZE + MAZE_OFFSET_Y);
+
+    // Generate initial directions for Player 2
+    maze.generateNewDirections(sx2, sy2, 1);
+    players[1].current_cell_dirs = maze.getCurrentDirections();
     #ifdef DEBUG_MODE
-    Serial.println("DEBUG: P2 initialized");
+    Log.println("DEBUG: P2 initialized");
     #endif
 
-    #ifdef DEBUG_MODE
-    Serial.println("DEBUG: Picking goal position...");
-    #endif
+    // Last round's entities are cleared below, so only the players are in the way
+    goal_distances.invalidate();   // Both players' exits are new, even if the goal cell is not
+    placeGoal(GOAL_START_PATH_DIST, EntityPool::cellBit(sx, sy) | EntityPool::cellBit(sx2, sy2));
 
-    // Initialize goal position
-    uint8_t gx, gy;
-    int dist_sq1, dist_sq2;
-    int goal_attempts = 0;
-    do {
-        gx = random(0, MAZE_WIDTH);
-        gy = random(0, MAZE_HEIGHT);
-
-        // Check dist from P1
-        int dx1 = (int)sx - (int)gx;
-        int dy1 = (int)sy - (int)gy;
-        dist_sq1 = dx1*dx1 + dy1*dy1;
-
-        // Check dist from P2
-        int dx2 = (int)players[1].x - (int)gx;
-        int dy2 = (int)players[1].y - (int)gy;
-        dist_sq2 = dx2*dx2 + dy2*dy2;
-
-        goal_attempts++;
-        if (goal_attempts > 1000) {
-            #ifdef DEBUG_MODE
-            Serial.println("DEBUG: Goal placement timeout!");
-            #endif
-            break;
-        }
-    } while (dist_sq1 < 100 || dist_sq2 < 100); // Min distance ~10 units from both
+    // Initialize goal sprite
+    SpriteRenderer::initInstance(&goal_sprite, &GOAL_SPRITE);
+
+    // Scatter items and hazards on free cells
+    entities.clear();
+    uint64_t avoid = getBlockedCells();
+    for (uint8_t i = 0; i < ENTITY_KEYS; i++) entities.spawnRandom(ENTITY_KEY, avoid);
+    for (uint8_t i = 0; i < ENTITY_TRAPS; i++) entities.spawnRandom(ENTITY_TRAP, avoid);
+    for (uint8_t i = 0; i < ENTITY_HAZARDS; i++) entities.spawnRandom(ENTITY_HAZARD, avoid);
 
+    // Decode every frame this round can draw into SRAM up front, so rendering
+    // never waits on flash
     #ifdef DEBUG_MODE
-    Serial.print("DEBUG: Goal = (");
-    Serial.print(gx);
-    Serial.print(",");
-    Serial.print(gy);
-    Serial.println(")");
+    SpriteCache::printStats();  // Previous round
     #endif
-
-    maze.setGoal(gx, gy);
-
-    // Initialize goal sprite
-    SpriteRenderer::initInstance(&goal_sprite, &GOAL_SPRITE);
+    SpriteCache::clear();
+    SpriteCache::prewarm(&PLAYER1_SPRITE, SPRITE_CACHE_NO_TINT);
+    SpriteCache::prewarm(&PLAYER2_SPRITE, SPRITE_CACHE_NO_TINT);
+    EntityPool::prewarm();
+    const uint16_t goal_tints[] = { GOAL_ACCESSIBLE, GOAL_COLOR, GOAL_DIST_ADJACENT,
+                                    GOAL_DIST_CLOSE, GOAL_DIST_MEDIUM, GOAL_DIST_FAR };
+    for (uint8_t i = 0; i < sizeof(goal_tints) / sizeof(goal_tints[0]); i++) {
+        SpriteCache::prewarm(&GOAL_SPRITE, goal_tints[i]);
+    }
 
     active_player = 0;  // Player 1 starts
-    state = STATE_PLAYING;
+    changeState(STATE_PLAYING);
 }
 
-void GameState::relocateGoal() {
-    // Pick new goal position away from both players
-    uint8_t gx, gy;
-    int dist_sq1, dist_sq2;
-    int goal_attempts = 0;
-
-    do {
-        gx = random(0, MAZE_WIDTH);
-        gy = random(0, MAZE_HEIGHT);
+void GameState::changeState(GameMode next) {
+    uint32_t now = millis();
+    // Leave from whatever is on screen, even if a transition is still running
+    outgoing_scene = getScene(now);
+    transition.start(TRANSITIONS[outgoing_scene][next], now);
+    state = next;
+}
 
-        // Check dist from P1
-        int dx1 = (int)players[0].x - (int)gx;
-        int dy1 = (int)players[0].y - (int)gy;
-        dist_sq1 = dx1*dx1 + dy1*dy1;
+GameMode GameState::getScene(uint32_t now) {
+    return transition.isOutgoing(now) ? outgoing_scene : state;
+}
 
-        // Check dist from P2
-        int dx2 = (int)players[1].x - (int)gx;
-        int dy2 = (int)players[1].y - (int)gy;
-        dist_sq2 = dx2*dx2 + dy2*dy2;
+void GameState::relocateGoal() {
+    // Away from both players, off any item or hazard
+    placeGoal(GOAL_RELOCATE_PATH_DIST, entities.getOccupied() |
+              EntityPool::cellBit(players[0].x, players[0].y) |
+              EntityPool::cellBit(players[1].x, players[1].y));
+}
 
-        goal_attempts++;
-        if (goal_attempts > 1000) break;
-    } while (dist_sq1 < 49 || dist_sq2 < 49);  // Min distance ~7 units from both
+void GameState::placeGoal(uint8_t min_dist, uint64_t exclude) {
+    #ifdef DEBUG_MODE
+    uint32_t t0 = micros();
+    #endif
+    uint8_t sources[2] = { EntityPool::cellIndex(players[0].x, players[0].y),
+                           EntityPool::cellIndex(players[1].x, players[1].y) };
+    distances.build(maze, sources, 2, exclude);
 
+    uint8_t gx, gy;
+    if (!distances.pick(min_dist, &gx, &gy)) {
+        // Nothing reachable is free: keep the goal where it is
+        gx = maze.getGoalX();
+        gy = maze.getGoalY();
+    }
     maze.setGoal(gx, gy);
 
     #ifdef DEBUG_MODE
-    Serial.print("Goal relocated to (");
-    Serial.print(gx);
-    Serial.print(",");
-    Serial.print(gy);
-    Serial.println(")");
+    Log.print("[PLACE] Goal (");
+    Log.print(gx);
+    Log.print(",");
+    Log.print(gy);
+    Log.print(") ");
+    Log.print(distances.distanceAt(gx, gy));
+    Log.print(" moves away, ");
+    Log.print(micros() - t0);
+    Log.println(" us");
     #endif
 }
 
 void GameState::handleInput(Direction dir) {
     if (dir == DIR_NONE) return;
+    finishMove();
+    last_move_prepared = false;
 
     switch (state) {
         case STATE_START:
@@ -206,31 +225,180 @@ void GameState::handleInput(Direction dir) {
     }
 }
 
+MovePlan GameState::planMove(uint8_t id, Direction dir) {
+    const Player& p = players[id];
+    MovePlan plan = { MOVE_INVALID, false, 0 };
+
+    bool valid = isValidMove(p, dir);
+    if (!valid && p.keys > 0 && isInBounds(p, dir)) {
+        // A key opens a closed exit (never the maze edge)
+        valid = true;
+        plan.used_key = true;
+    }
+    if (!valid) return plan;
+
+    // Hazards block the cell they stand on
+    uint8_t tx = p.x, ty = p.y;
+    switch (dir) {
+        case NORTH: ty--; break;
+        case SOUTH: ty++; break;
+        case EAST:  tx++; break;
+        case WEST:  tx--; break;
+        default: break;
+    }
+    if (entities.has(ENTITY_HAZARD, tx, ty)) {
+        plan.used_key = false;
+        return plan;
+    }
+
+    plan.exits = maze.peekDirections(tx, ty, id);
+    plan.result = maze.isGoal(tx, ty) ? MOVE_GOAL : MOVE_VALID;
+    return plan;
+}
+
+MoveContext GameState::getMoveContext() {
+    const Player& p = players[active_player];
+    MoveContext ctx;
+    ctx.occupied = entities.getOccupied();
+    ctx.epoch = move_epoch;
+    ctx.passage_version = maze.getPassageVersion();
+    ctx.player = active_player;
+    ctx.x = p.x;
+    ctx.y = p.y;
+    ctx.dirs = p.current_cell_dirs;
+    ctx.keys = p.keys;
+    ctx.goal = EntityPool::cellIndex(maze.getGoalX(), maze.getGoalY());
+    ctx.min_exits = maze.getMinExits();
+    ctx.max_exits = maze.getMaxExits();
+    return ctx;
+}
+
+void GameState::prepareMoves() {
+    if (!speculate || state != STATE_PLAYING) return;
+    MoveContext ctx = getMoveContext();
+    if (plans_ready && ctx == plan_context) return;
+    for (uint8_t d = 0; d < 4; d++) plans[d] = planMove(active_player, (Direction)d);
+    plan_context = ctx;
+    plans_ready = true;
+}
+
 void GameState::handleTwoPlayerMove(Direction dir) {
     Player& p = players[active_player];
 
-    if (isValidMove(p, dir)) {
-        movePlayer(p, dir);
-        p.moves++;
-
-        maze.generateNewDirections(p.x, p.y);
-        p.current_cell_dirs = maze.getCurrentDirections();
-
-        if (maze.isGoal(p.x, p.y)) {
-            state = STATE_GOAL_MESSAGE;
-            goalMessageStart = millis();
-            lastMoveResult = MOVE_GOAL;
-            relocateGoal();
-            // Switch turns after goal reached
-            active_player = 1 - active_player;
-            return;
-        }
+    // A result prepareMoves() worked out while idle, if nothing it depends on
+    // has changed since; otherwise decide now
+    last_move_prepared = speculate && plans_ready && getMoveContext() == plan_context;
+    MovePlan plan = last_move_prepared ? plans[dir] : planMove(active_player, dir);
+    plans_ready = false;
 
-        active_player = 1 - active_player;
-        lastMoveResult = MOVE_VALID;
-    } else {
-        lastMoveResult = MOVE_INVALID;
+    lastMoveResult = plan.result;
+    if (plan.result == MOVE_INVALID) {
+        SpriteRenderer::play(&p.sprite, CLIP_BUMP);
+        return;
+    }
+
+    // Only what decides the next move happens before the ack; the rest waits
+    // for finishMove()
+    if (plan.used_key) p.keys--;
+    movePlayer(p, dir);
+    p.moves++;
+    maze.commitDirections(p.x, p.y, active_player, plan.exits);
+    p.current_cell_dirs = plan.exits;
+    move_epoch++;
+    pending_move = dir;
+}
+
+void GameState::finishMove() {
+    if (pending_move == DIR_NONE) return;
+    Direction dir = pending_move;
+    pending_move = DIR_NONE;
+    Player& p = players[active_player];
+
+    // Logic is already in the new cell; the sprite catches up over the next frames
+    Motion::moveTo(&p.motion, p.x * CELL_SIZE, p.y * CELL_SIZE + MAZE_OFFSET_Y,
+                   MOVE_TWEEN_MS, EASE_OUT_QUAD, millis());
+    SpriteRenderer::play(&p.sprite, (SpriteClip)(CLIP_WALK_N + dir));
+    goal_distances.updatePlayer(active_player, p.x, p.y, p.current_cell_dirs);
+
+    if (maze.isGoal(p.x, p.y)) {
+        // Celebrate at the goal cell before it moves away
+        int16_t cx = p.x * CELL_SIZE + CELL_SIZE / 2;
+        int16_t cy = p.y * CELL_SIZE + MAZE_OFFSET_Y + CELL_SIZE / 2;
+        particles.emitBurst(cx, cy, GOAL_BURST_COUNT, p.color);
+        particles.emitSparks(cx, cy, GOAL_BURST_COUNT / 2);
+        SpriteRenderer::play(&p.sprite, CLIP_CELEBRATE);
+
+        changeState(STATE_GOAL_MESSAGE);
+        goalMessageStart = millis();
+        relocateGoal();
+        // Switch turns after goal reached
+        passTurn();
+        return;
+    }
+
+    enterCell(p);
+    passTurn();
+}
+
+void GameState::enterCell(Player& p) {
+    uint8_t slot = entities.at(p.x, p.y);
+    if (slot == ENTITY_NONE) return;
+
+    int16_t cx = p.x * CELL_SIZE + CELL_SIZE / 2;
+    int16_t cy = p.y * CELL_SIZE + MAZE_OFFSET_Y + CELL_SIZE / 2;
+    switch (entities.getType(slot)) {
+        case ENTITY_KEY:
+            p.keys++;
+            particles.emitSparks(cx, cy, 12);
+            entities.remove(slot);
+            break;
+        case ENTITY_TRAP:
+            p.trapped = true;
+            particles.emitBurst(cx, cy, 12, BLOCKED_COLOR);
+            entities.remove(slot);
+            break;
+        default:
+            break;
+    }
+}
+
+void GameState::passTurn() {
+    uint8_t next = 1 - active_player;
+    if (players[next].trapped) {
+        // Trapped player sits this turn out; the current one goes again
+        players[next].trapped = false;
+        return;
     }
+    active_player = next;
+}
+
+void GameState::setMazePersistent(bool on) {
+    finishMove();
+    maze.setPersistent(on);
+    refreshPlayerExits();
+}
+
+void GameState::setMazeAlgorithm(uint8_t id) {
+    finishMove();
+    maze.setAlgorithm(id);
+    refreshPlayerExits();
+}
+
+void GameState::refreshPlayerExits() {
+    // Exits a player got from the old maze would let them through the new one's
+    // walls; the start screen has no round yet (resetGame() reads them fresh)
+    if (state == STATE_START) return;
+    for (uint8_t i = 0; i < 2; i++) {
+        maze.generateNewDirections(players[i].x, players[i].y, i);
+        players[i].current_cell_dirs = maze.getCurrentDirections();
+    }
+    plans_ready = false;
+}
+
+uint64_t GameState::getBlockedCells() {
+    return EntityPool::cellBit(players[0].x, players[0].y) |
+           EntityPool::cellBit(players[1].x, players[1].y) |
+           EntityPool::cellBit(maze.getGoalX(), maze.getGoalY());
 }
 
 MoveResult GameState::getLastMoveResult() {
@@ -240,24 +408,32 @@ MoveResult GameState::getLastMoveResult() {
 }
 
 void GameState::triggerWin() {
+    finishMove();
     if (state == STATE_PLAYING || state == STATE_GOAL_MESSAGE) {
         winner = active_player;
-        state = STATE_WIN;
-        Serial.print("[GAME] Player ");
-        Serial.print(winner + 1);
-        Serial.println(" wins!");
+        changeState(STATE_WIN);
+        particles.emitConfetti(0, MATRIX_WIDTH, 32);
+
+        // Lines wider than the panel scroll; their text is rasterized only here
+        char line[48];
+        snprintf(line, sizeof(line), "P%d%s", winner + 1, TEXT_WIN_ESCAPED);
+        marquee.setLane(0, 4, line, players[winner].color, WIN_HEADLINE_SPEED);
+        snprintf(line, sizeof(line), "%s %s %s", TEXT_WIN_L3, TEXT_WIN_L4, TEXT_WIN_L5);
+        marquee.setLane(1, 34, line, 0xFFFF, WIN_MESSAGE_SPEED);
+
+        Log.print("[GAME] Player ");
+        Log.print(winner + 1);
+        Log.println(" wins!");
     }
 }
 
+bool GameState::isInBounds(const Player& p, Direction dir) {
+    return dir < DIR_NONE && MAZE_CAN_STEP[dir].test(EntityPool::cellIndex(p.x, p.y));
+}
+
 bool GameState::isValidMove(const Player& p, Direction dir) {
     // Check grid bounds
-    switch (dir) {
-        case NORTH: if (p.y == 0) return false; break;
-        case SOUTH: if (p.y >= MAZE_HEIGHT - 1) return false; break;
-        case EAST:  if (p.x >= MAZE_WIDTH - 1) return false; break;
-        case WEST:  if (p.x == 0) return false; break;
-        default: return false;
-    }
+    if (!isInBounds(p, dir)) return false;
 
     // Check player's current cell allows this direction
     return (p.current_cell_dirs & (1 << dir)) != 0;
@@ -273,25 +449,51 @@ void GameState::movePlayer(Player& p, Direction dir) {
 }
 
 void GameState::update() {
-    // Update sprite animations
-    SpriteRenderer::updateAnimation(&players[0].sprite);
-    SpriteRenderer::updateAnimation(&players[1].sprite);
-    SpriteRenderer::updateAnimation(&goal_sprite);
+    finishMove();   // Normally done right after the ack already
+
+    // One animation clock tick per rendered frame, all sprites in one pass
+    SpriteInstance* animated[3 + ENTITY_CAPACITY] = { &players[0].sprite, &players[1].sprite, &goal_sprite };
+    uint8_t animated_count = 3 + entities.collectSprites(animated + 3, ENTITY_CAPACITY);
+    SpriteRenderer::tick(animated, animated_count);
+
+    if (state == STATE_PLAYING) {
+        entities.update(millis(), getBlockedCells(), maze.getPassageBoards());
+    }
+
+    // Keep confetti falling for as long as the win screen is up
+    if (state == STATE_WIN) {
+        particles.emitConfetti(0, MATRIX_WIDTH, WIN_CONFETTI_RATE);
+        marquee.update();
+    }
+    particles.update();
 
     // Check if goal message display time has elapsed
     if (state == STATE_GOAL_MESSAGE && (millis() - goalMessageStart >= 2000)) {
-        state = STATE_PLAYING;
+        changeState(STATE_PLAYING);
     }
 }
 
 void GameState::render(DisplayManager* display, bool d9_held) {
-    display->clear();
+    // Only one screen is drawn per frame, even mid-transition
+    uint32_t now = millis();
+    GameMode scene = getScene(now);
+
+    if (scene == STATE_START) {
+        // The scrolling band keeps its pixels between frames; clear around it
+        display->fillRect(0, 0, MATRIX_WIDTH, ATTRACT_MAZE_Y, 0x0000);
+        display->fillRect(0, ATTRACT_MAZE_Y + ATTRACT_BAND_PX, MATRIX_WIDTH,
+                          MATRIX_HEIGHT - ATTRACT_MAZE_Y - ATTRACT_BAND_PX, 0x0000);
+        backdrop.render(display, now);
+    } else {
+        backdrop.stop(display);
+        display->clear();
+    }
 
-    if (state == STATE_START) {
+    if (scene == STATE_START) {
         renderStartScreen(display);
-    } else if (state == STATE_GOAL_MESSAGE) {
+    } else if (scene == STATE_GOAL_MESSAGE) {
         renderGoalMessage(display);
-    } else if (state == STATE_WIN) {
+    } else if (scene == STATE_WIN) {
         renderWinScreen(display);
     } else {
         // STATE_PLAYING
@@ -299,6 +501,9 @@ void GameState::render(DisplayManager* display, bool d9_held) {
         renderTwoPlayer(display);
     }
 
+    particles.render(display);
+
+    transition.apply(display, now);
     display->update();
 }
 
@@ -327,12 +532,19 @@ void GameState::renderTwoPlayer(DisplayManager* display) {
     renderPlayerFog(display, players[1], P2_FOG_COLOR);
     renderBlockedDirections(display, players[1]);
 
-    renderGoal(display);
+    // Sprites go through one batch: the active player is drawn on top
+    sprites.begin();
+    submitGoal();
+    uint32_t now = millis();
+    entities.submit(&sprites, now);
+    for (uint8_t i = 0; i < 2; i++) {
+        int16_t px, py;
+        Motion::getPosition(&players[i].motion, now, &px, &py);
+        sprites.submit(&players[i].sprite, px, py, i == active_player ? Z_ACTIVE_PLAYER : Z_PLAYER);
+    }
+    sprites.flush(display);
 
-    SpriteRenderer::draw(display, &players[0].sprite,
-                         players[0].x * CELL_SIZE, players[0].y * CELL_SIZE + MAZE_OFFSET_Y);
-    SpriteRenderer::draw(display, &players[1].sprite,
-                         players[1].x * CELL_SIZE, players[1].y * CELL_SIZE + MAZE_OFFSET_Y);
+    renderGoalMarkers(display);
 
     display->drawRect(TURN_INDICATOR_X - 1, TURN_INDICATOR_Y - 1, 6, 6, ACTIVE_HIGHLIGHT);
     display->fillRect(TURN_INDICATOR_X, TURN_INDICATOR_Y, 4, 4,
@@ -345,8 +557,7 @@ void GameState::renderPlayerFog(DisplayManager* display, const Player& p, uint16
     uint8_t gy = maze.getGoalY();
 
     auto drawThickBorder = [&](int16_t x, int16_t y) {
-        display->drawRect(x, y, CELL_SIZE, CELL_SIZE, fog_color);
-        display->drawRect(x+1, y+1, CELL_SIZE-2, CELL_SIZE-2, fog_color);
+        display->blendFrame(x, y, CELL_SIZE, CELL_SIZE, 2, fog_color, FOG_ALPHA);
     };
 
     if ((dirs & (1 << NORTH)) && p.y > 0) {
@@ -377,7 +588,7 @@ void GameState::renderBlockedDirections(DisplayManager* display, const Player& p
         int16_t nx = p.x * CELL_SIZE;
         int16_t ny = (p.y - 1) * CELL_SIZE + MAZE_OFFSET_Y;
         if (!(p.x == gx && p.y - 1 == gy)) {
-            display->fillRect(nx, ny + CELL_SIZE - 2, CELL_SIZE, 2, BLOCKED_COLOR);
+            display->blendRect(nx, ny + CELL_SIZE - 2, CELL_SIZE, 2, BLOCKED_COLOR, BLOCKED_ALPHA);
         }
     }
 
@@ -385,7 +596,7 @@ void GameState::renderBlockedDirections(DisplayManager* display, const Player& p
         int16_t nx = p.x * CELL_SIZE;
         int16_t ny = (p.y + 1) * CELL_SIZE + MAZE_OFFSET_Y;
         if (!(p.x == gx && p.y + 1 == gy)) {
-            display->fillRect(nx, ny, CELL_SIZE, 2, BLOCKED_COLOR);
+            display->blendRect(nx, ny, CELL_SIZE, 2, BLOCKED_COLOR, BLOCKED_ALPHA);
         }
     }
 
@@ -393,7 +604,7 @@ void GameState::renderBlockedDirections(DisplayManager* display, const Player& p
         int16_t nx = (p.x + 1) * CELL_SIZE;
         int16_t ny = p.y * CELL_SIZE + MAZE_OFFSET_Y;
         if (!(p.x + 1 == gx && p.y == gy)) {
-            display->fillRect(nx, ny, 2, CELL_SIZE, BLOCKED_COLOR);
+            display->blendRect(nx, ny, 2, CELL_SIZE, BLOCKED_COLOR, BLOCKED_ALPHA);
         }
     }
 
@@ -401,7 +612,7 @@ void GameState::renderBlockedDirections(DisplayManager* display, const Player& p
         int16_t nx = (p.x - 1) * CELL_SIZE;
         int16_t ny = p.y * CELL_SIZE + MAZE_OFFSET_Y;
         if (!(p.x - 1 == gx && p.y == gy)) {
-            display->fillRect(nx + CELL_SIZE - 2, ny, 2, CELL_SIZE, BLOCKED_COLOR);
+            display->blendRect(nx + CELL_SIZE - 2, ny, 2, CELL_SIZE, BLOCKED_COLOR, BLOCKED_ALPHA);
         }
     }
 }
@@ -421,17 +632,43 @@ void GameState::drawGoalBarrier(DisplayManager* display, uint8_t gx, uint8_t gy,
     }
 }
 
-void GameState::renderGoal(DisplayManager* display) {
+void GameState::submitGoal() {
     uint8_t gx = maze.getGoalX();
     uint8_t gy = maze.getGoalY();
-    int16_t gpx = gx * CELL_SIZE;
-    int16_t gpy = gy * CELL_SIZE + MAZE_OFFSET_Y;
 
-    // Calculate distance for color
-    uint8_t dist1 = abs((int)players[0].x - (int)gx) + abs((int)players[0].y - (int)gy);
-    uint8_t dist2 = abs((int)players[1].x - (int)gx) + abs((int)players[1].y - (int)gy);
+    // Path distance for color: the field is rebuilt only after the goal or
+    // the passages changed, moves refresh the mover's entry
+    if (goal_distances.refresh(maze)) {
+        for (uint8_t i = 0; i < 2; i++) {
+            goal_distances.updatePlayer(i, players[i].x, players[i].y, players[i].current_cell_dirs);
+        }
+    }
+    uint8_t dist1 = goal_distances.getPlayerDistance(0);
+    uint8_t dist2 = goal_distances.getPlayerDistance(1);
     uint8_t min_dist = (dist2 < dist1) ? dist2 : dist1;
 
+    bool p1_adjacent = isAdjacent(players[0], gx, gy);
+    bool p2_adjacent = isAdjacent(players[1], gx, gy);
+    bool can_reach = (p1_adjacent && canReachGoal(players[0], gx, gy)) ||
+                     (p2_adjacent && canReachGoal(players[1], gx, gy));
+
+    uint16_t tint;
+    if (can_reach) {
+        tint = GOAL_ACCESSIBLE;                     // ACCESSIBLE
+    } else if (p1_adjacent || p2_adjacent) {
+        tint = GOAL_COLOR;                          // ADJACENT BUT BLOCKED
+    } else {
+        tint = getGoalColorForDistance(min_dist);   // NOT ADJACENT
+    }
+    sprites.submit(&goal_sprite, gx * CELL_SIZE, gy * CELL_SIZE + MAZE_OFFSET_Y, Z_GOAL, tint);
+}
+
+void GameState::renderGoalMarkers(DisplayManager* display) {
+    uint8_t gx = maze.getGoalX();
+    uint8_t gy = maze.getGoalY();
+    int16_t gpx = gx * CELL_SIZE;
+    int16_t gpy = gy * CELL_SIZE + MAZE_OFFSET_Y;
+
     // Check adjacency and reachability for each player
     bool p1_adjacent = isAdjacent(players[0], gx, gy);
     bool p2_adjacent = isAdjacent(players[1], gx, gy);
@@ -439,24 +676,17 @@ void GameState::renderGoal(DisplayManager* display) {
     bool p2_can_reach = p2_adjacent && canReachGoal(players[1], gx, gy);
 
     if (p1_can_reach || p2_can_reach) {
-        // ACCESSIBLE
-        SpriteRenderer::drawWithColorTint(display, &goal_sprite, gpx, gpy, GOAL_ACCESSIBLE);
+        // ACCESSIBLE: open door
         display->fillRect(gpx + 2, gpy + 2, 4, 4, 0x0000);
 
     } else if (p1_adjacent || p2_adjacent) {
         // ADJACENT BUT BLOCKED
-        SpriteRenderer::drawWithColorTint(display, &goal_sprite, gpx, gpy, GOAL_COLOR);
         if (p1_adjacent && !p1_can_reach) {
             drawGoalBarrier(display, gx, gy, players[0]);
         }
         if (p2_adjacent && !p2_can_reach) {
             drawGoalBarrier(display, gx, gy, players[1]);
         }
-
-    } else {
-        // NOT ADJACENT
-        uint16_t goal_color = getGoalColorForDistance(min_dist);
-        SpriteRenderer::drawWithColorTint(display, &goal_sprite, gpx, gpy, goal_color);
     }
 }
 
@@ -563,12 +793,9 @@ void GameState::renderGoalMessage(DisplayManager* display) {
 void GameState::renderWinScreen(DisplayManager* display) {
     display->setTextSize(1);
 
-    // Line 1: "P1 ESCAPED!" or "P2 ESCAPED!" (winner in their color)
-    display->setCursor(4, 4);
-    display->setTextColor(players[winner].color);
-    display->print("P");
-    display->print(winner + 1);
-    display->print(TEXT_WIN_ESCAPED);
+    // Line 1 ("P1 ESCAPED!") and the "one more rabbit hole..." line are
+    // marquee lanes set up in triggerWin(); drawing them is a row copy
+    marquee.render(display);
 
     // Line 2: "P2 wants" or "P1 wants" (other player)
     uint8_t other = 1 - winner;
@@ -577,13 +804,4 @@ void GameState::renderWinScreen(DisplayManager* display) {
     display->print("P");
     display->print(other + 1);
     display->print(TEXT_WIN_WANTS);
-
-    // Lines 3-5: "one more / rabbit / hole..." (white)
-    display->setTextColor(0xFFFF);
-    display->setCursor(8, 30);
-    display->print(TEXT_WIN_L3);
-    display->setCursor(14, 42);
-    display->print(TEXT_WIN_L4);
-    display->setCursor(10, 54);
-    display->print(TEXT_WIN_L5);
 }
\ No newline at end of file
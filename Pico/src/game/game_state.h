@@ -6,7 +6,15 @@
 #include <Arduino.h>
 #include "../display/display_manager.h"
 #include "maze_generator.h"
+#include "motion.h"
+#include "entities.h"
+#include "placement.h"
+#include "scrolling_maze.h"
 #include "../sprites/sprite.h"
+#include "../sprites/sprite_batch.h"
+#include "../effects/particle_system.h"
+#include "../display/marquee.h"
+#include "../display/transition.h"
 
 enum GameMode {
     STATE_START,
@@ -23,6 +31,28 @@ enum MoveResult {
     MOVE_GOAL       // Player reached goal (goal relocates, game continues)
 };
 
+// One possible move of the active player, decided ahead of the input
+struct MovePlan {
+    MoveResult result;         // MOVE_VALID, MOVE_INVALID or MOVE_GOAL
+    bool used_key;             // Opens a closed exit
+    uint8_t exits;             // Exits the destination gets on entry
+};
+
+// Everything a MovePlan depends on; plans are reused only while it is unchanged
+struct MoveContext {
+    uint64_t occupied;         // Entity cells (hazards move on a timer)
+    uint32_t epoch;            // Bumped by every move and new round
+    uint16_t passage_version;  // Maze mode / algorithm switched from the console
+    uint8_t player, x, y, dirs, keys, goal;
+    uint8_t min_exits, max_exits;
+
+    bool operator==(const MoveContext& o) const {
+        return occupied == o.occupied && epoch == o.epoch && passage_version == o.passage_version &&
+               player == o.player && x == o.x && y == o.y && dirs == o.dirs && keys == o.keys &&
+               goal == o.goal && min_exits == o.min_exits && max_exits == o.max_exits;
+    }
+};
+
 // Player data structure
 struct Player {
     uint8_t x, y;              // Position
@@ -30,6 +60,9 @@ struct Player {
     uint8_t current_cell_dirs; // Per-player maze state (bitfield)
     uint16_t moves;            // Per-player move counter
     SpriteInstance sprite;     // Animated sprite
+    MotionTween motion;        // On-screen position (tweens between cells)
+    uint8_t keys;              // Collected keys, each opens one closed exit
+    bool trapped;              // Sits out the next turn
 };
 
 class GameState {
@@ -38,24 +71,54 @@ private:
     Player players[2];         // Array of two players
     MazeGenerator maze;
     SpriteInstance goal_sprite;  // Animated goal sprite
+    SpriteBatch sprites;         // Goal, items + players, z-sorted and drawn together
+    EntityPool entities;         // Keys, traps and hazards on the grid
+    DistanceField distances;     // Path distances for spawn/goal placement
+    GoalDistances goal_distances;  // Cached path distances to the goal (heat map)
+    ParticleSystem particles;    // Goal/win celebrations, drawn over any screen
+    Marquee marquee;             // Scrolling win-screen lines (rendered once per win)
+    Transition transition;       // Between screens, applied by the display driver
+    GameMode outgoing_scene;     // Screen shown until the transition's midpoint
+    ScrollingMaze backdrop;      // Endless maze behind the start screen
 
     uint8_t active_player;     // 0 or 1 (whose turn)
     uint8_t winner;            // 0 or 1 (who escaped)
     MoveResult lastMoveResult; // Result of last move attempt
     uint32_t goalMessageStart; // Timer for goal message display
 
+    // Speculative moves: all four outcomes of the active player's next move,
+    // prepared in idle time so a move only commits one and can be acked at once
+    MovePlan plans[4];         // Indexed by Direction
+    MoveContext plan_context;  // Inputs the plans were made from
+    bool plans_ready;
+    bool speculate;            // Off = every move is decided when it arrives
+    bool last_move_prepared;   // Last move used a prepared plan
+    uint32_t move_epoch;
+    Direction pending_move;    // Committed, aftermath not run yet (DIR_NONE = none)
+
     void resetGame();
+    void changeState(GameMode next);                     // Switch screens via the pair's transition
+    GameMode getScene(uint32_t now);                     // State whose screen is on display
     void relocateGoal();       // Move goal to new random location
+    void placeGoal(uint8_t min_dist, uint64_t exclude);  // Reachable, >= min_dist moves from both players
 
     // Internal helpers
-    void handleTwoPlayerMove(Direction dir);
+    void handleTwoPlayerMove(Direction dir);            // Commits the move, ack-critical part only
+    MovePlan planMove(uint8_t id, Direction dir);        // Outcome without changing anything
+    MoveContext getMoveContext();
     bool isValidMove(const Player& p, Direction dir);
+    bool isInBounds(const Player& p, Direction dir);
+    void enterCell(Player& p);                           // Pick up / spring what is in p's cell
+    void passTurn();                                     // Next player, skipping a trapped one
+    void refreshPlayerExits();                           // After the maze was rebuilt
+    uint64_t getBlockedCells();                          // Players + goal, for hazards
     void movePlayer(Player& p, Direction dir);
     void renderStatusBar(DisplayManager* display, bool d9_held);
     void renderTwoPlayer(DisplayManager* display);
     void renderPlayerFog(DisplayManager* display, const Player& p, uint16_t fog_color);
     void renderBlockedDirections(DisplayManager* display, const Player& p);
-    void renderGoal(DisplayManager* display);
+    void submitGoal();                                   // Goal sprite into the batch
+    void renderGoalMarkers(DisplayManager* display);     // Door/barrier overlays, above sprites
     void drawGoalBarrier(DisplayManager* display, uint8_t gx, uint8_t gy, const Player& p);
     void renderStartScreen(DisplayManager* display);
     void renderGoalMessage(DisplayManager* display);     // "A little bit more" rainbow
@@ -68,6 +131,11 @@ public:
     GameState(); // Constructor
     void init();
     void handleInput(Direction dir);
+    void finishMove();          // Animation, goal, items, turn of the last move (after the ack)
+    void prepareMoves();        // Idle time: work out the active player's next move
+    bool wasMovePrepared() { return last_move_prepared; }
+    void setSpeculation(bool on) { speculate = on; plans_ready = false; }
+    bool isSpeculating() { return speculate; }
     void update();
     void render(DisplayManager* display, bool d9_held);
 
@@ -80,6 +148,14 @@ public:
 
     // Move result for R4 communication
     MoveResult getLastMoveResult();
+
+    // Run-time tuning (console)
+    // Maze mode / algorithm switches that apply mid-game: both players' exits
+    // are re-read from the rebuilt maze
+    void setMazePersistent(bool on);
+    void setMazeAlgorithm(uint8_t id);
+    MazeGenerator& getMaze() { return maze; }
+    EntityPool& getEntities() { return entities; }
 };
 
 #endif // GAME_STATE_H
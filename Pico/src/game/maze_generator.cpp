@@ -1,6 +1,67 @@
 // game/maze_generator.cpp
 #include "maze_generator.h"
-#include "../config.h"
+#include "../serial_log.h"
+
+MazeGenerator::MazeGenerator() : walls(wall_bits, MAZE_WIDTH, MAZE_HEIGHT) {
+    min_exits = MAZE_MIN_EXITS;
+    max_exits = MAZE_MAX_EXITS;
+    persistent = MAZE_PERSISTENT;
+    algorithm = MAZE_ALGORITHM;
+    maze_seed = 0;
+    passage_version = 0;
+    walls.clear();
+    loadPassageBoards();
+}
+
+void MazeGenerator::setPersistent(bool on) {
+    persistent = on;
+    if (persistent) {
+        buildWalls();
+    } else {
+        loadPassageBoards();
+    }
+}
+
+void MazeGenerator::setAlgorithm(uint8_t id) {
+    if (id >= MAZE_ALGO_COUNT) return;
+    algorithm = id;
+    if (persistent) buildWalls();
+}
+
+void MazeGenerator::buildWalls() {
+    const MazeAlgorithm& algo = MAZE_ALGORITHMS[algorithm];
+    uint32_t t0 = micros();
+    algo.generate(walls, maze_seed, (uint8_t*)scratch);
+    uint32_t elapsed = micros() - t0;
+    loadPassageBoards();
+
+    Log.print("[MAZE] ");
+    Log.print(algo.name);
+    Log.print(": ");
+    Log.print(elapsed);
+    Log.print(" us, ");
+    Log.print(walls.storageBytes());
+    Log.print(" B walls + ");
+    Log.print(algo.scratchBytes(MAZE_WIDTH, MAZE_HEIGHT));
+    Log.println(" B scratch");
+}
+
+void MazeGenerator::setExitRange(uint8_t min_count, uint8_t max_count) {
+    if (min_count < 1) min_count = 1;
+    if (max_count > 4) max_count = 4;
+    if (max_count < min_count) max_count = min_count;
+    min_exits = min_count;
+    max_exits = max_count;
+}
+
+void MazeGenerator::loadPassageBoards() {
+    if (persistent) {
+        loadPassages(walls, passages);
+    } else {
+        for (uint8_t d = 0; d < 4; d++) passages[d] = MAZE_CAN_STEP[d];
+    }
+    passage_version++;
+}
 
 void MazeGenerator::init() {
     // Default start state
@@ -10,8 +71,16 @@ void MazeGenerator::init() {
     goal_x = MAZE_WIDTH - 1;
     goal_y = MAZE_HEIGHT - 1;
 
+    setSeed((uint32_t)random() ^ ((uint32_t)random() << 16));
+    Log.print("[MAZE] Seed ");
+    Log.println(maze_seed);
+}
 
-    maze_seed = random(1000000);
+void MazeGenerator::setSeed(uint32_t seed) {
+    maze_seed = seed;
+    seed_key = mazeMix32(seed ^ 0x9E3779B9u);
+    memset(visits, 0, sizeof(visits));
+    if (persistent) buildWalls();
 }
 
 uint8_t MazeGenerator::getCurrentDirections() {
@@ -28,40 +97,55 @@ bool MazeGenerator::isDirectionValid(uint8_t x, uint8_t y, Direction dir) {
     return (current_cell_dirs & (1 << dir)) != 0;
 }
 
-void MazeGenerator::generateNewDirections(uint8_t x, uint8_t y) {
-    // Non-deterministic: allows escaping loops by revisiting cells
-    // randomSeed(maze_seed + (long)x * 37 + (long)y * 73); 
+void MazeGenerator::generateNewDirections(uint8_t x, uint8_t y, uint8_t stream) {
+    commitDirections(x, y, stream, peekDirections(x, y, stream));
+}
 
-    uint8_t dirs = 0;
-    // Randomly choose to have 1, 2, or 3 exits from this cell
-    uint8_t num_exits = 1 + (random() % 3);
+uint8_t MazeGenerator::peekDirections(uint8_t x, uint8_t y, uint8_t stream) const {
+    if (persistent) return walls.openings(x, y);
+    return directionsFor(x, y, stream, visits[stream][y * MAZE_WIDTH + x]);
+}
 
-    // Try to add random directions
-    int attempts = 0;
-    int added = 0;
-    
-    // Attempt 10 times to pick unique, valid directions.
-    while (added < num_exits && attempts < 10) {
-        Direction dir = (Direction)(random() % 4); // Pick 0-3
-
-        if (!isOutOfBounds(x, y, dir) && !(dirs & (1 << dir))) {
-            dirs |= (1 << dir);
-            added++;
-        }
-        attempts++;
-    }
+void MazeGenerator::commitDirections(uint8_t x, uint8_t y, uint8_t stream, uint8_t dirs) {
+    current_cell_dirs = dirs;
+    // Revisits count up, so a cell's exits still change when re-entered
+    // (keeps loops escapable) while staying reproducible from the seed
+    if (!persistent) visits[stream][y * MAZE_WIDTH + x]++;
+}
 
-    // Ensure at least one exit
-    if (dirs == 0) {
-        for (int d = 0; d < 4; d++) {
-            if (!isOutOfBounds(x, y, (Direction)d)) {
-                dirs |= (1 << d);
-                break;
-            }
-        }
+uint8_t MazeGenerator::getPassages(uint8_t x, uint8_t y) const {
+    uint32_t cell = y * MAZE_WIDTH + x;
+    return passages[NORTH].test(cell) << NORTH | passages[EAST].test(cell) << EAST |
+           passages[SOUTH].test(cell) << SOUTH | passages[WEST].test(cell) << WEST;
+}
+
+uint8_t MazeGenerator::directionsFor(uint8_t x, uint8_t y, uint8_t stream, uint16_t visit) const {
+    // Counter: stream | cell | visit, unique per call site of the game
+    uint32_t h = mazeMix32(seed_key ^ ((uint32_t)stream << 28 |
+                                   (uint32_t)(y * MAZE_WIDTH + x) << 16 | visit));
+
+    // In-bounds directions
+    uint8_t dirs[4];
+    uint8_t n = 0;
+    for (uint8_t d = 0; d < 4; d++) {
+        if (MAZE_CAN_STEP[d].test(y * MAZE_WIDTH + x)) dirs[n++] = d;
     }
 
-    current_cell_dirs = dirs;
+    // Byte 0 picks the exit count, bytes 1-3 a partial Fisher-Yates shuffle;
+    // (byte * range) >> 8 maps a byte onto 0..range-1 without division
+    uint8_t want = min_exits + (((h & 0xFF) * (max_exits - min_exits + 1)) >> 8);
+    if (want > n) want = n;
+
+    uint8_t result = 0;
+    for (uint8_t i = 0; i < want; i++) {
+        h >>= 8;
+        uint8_t j = i + (((h & 0xFF) * (n - i)) >> 8);
+        uint8_t d = dirs[j];
+        dirs[j] = dirs[i];
+        dirs[i] = d;
+        result |= 1 << d;
+    }
+    return result;
 }
 
 void MazeGenerator::setGoal(uint8_t gx, uint8_t gy) {
@@ -74,11 +158,5 @@ bool MazeGenerator::isGoal(uint8_t x, uint8_t y) {
 }
 
 bool MazeGenerator::isOutOfBounds(uint8_t x, uint8_t y, Direction dir) {
-    switch (dir) {
-        case NORTH: return (y == 0);
-        case SOUTH: return (y >= MAZE_HEIGHT - 1);
-        case EAST:  return (x >= MAZE_WIDTH - 1);
-        case WEST:  return (x == 0);
-        default:    return true;
-    }
+    return dir >= DIR_NONE || !MAZE_CAN_STEP[dir].test(y * MAZE_WIDTH + x);
 }
@@ -1,10 +1,19 @@
 // game/maze_generator.h
 // Procedural maze generation using random direction assignment
-// optimized for memoryless/rogue-like gameplay (no grid storage)
+// optimized for memoryless/rogue-like gameplay (no grid storage).
+// A cell's exits are a counter-based hash of (seed, stream, cell, visit), so
+// a seed reproduces the whole game and each player gets an independent stream.
+// Persistent mode instead carves a real maze from the seed into a WallGrid
+// (maze_grid.h) and reads each cell's exits from it.
 #ifndef MAZE_GENERATOR_H
 #define MAZE_GENERATOR_H
 
 #include <Arduino.h>
+#include "../config.h"
+#include "maze_grid.h"
+#include "bitboard.h"
+
+#define MAZE_STREAMS  2        // Independent direction streams (one per player)
 
 // Movement directions
 enum Direction {
@@ -19,10 +28,38 @@ class MazeGenerator {
 private:
     uint8_t current_cell_dirs; // Bitfield for the active cell only
     uint8_t goal_x, goal_y;
-    long maze_seed;            // NEW: Seed for deterministic generation
+    uint32_t maze_seed;        // Seed for deterministic generation
+    uint32_t seed_key;         // Hashed seed, keys every cell hash
+    uint8_t min_exits, max_exits;  // Exits per generated cell
+    uint16_t visits[MAZE_STREAMS][MAZE_WIDTH * MAZE_HEIGHT];  // Entries per cell, per stream
+
+    bool persistent;           // Exits from `walls` instead of the per-visit hash
+    uint8_t algorithm;         // MazeAlgorithmId used to carve `walls`
+    uint8_t wall_bits[MAZE_GRID_BYTES(MAZE_WIDTH, MAZE_HEIGHT)];
+    uint16_t scratch[(MAZE_SCRATCH_BYTES(MAZE_WIDTH, MAZE_HEIGHT) + 1) / 2];  // 2-byte aligned
+    WallGrid walls;
+    MazeBits passages[4];      // Cells with a passage NORTH..WEST (see getPassages)
+    uint16_t passage_version;  // Bumped whenever `passages` is reloaded
 
 public:
-    void init();
+    MazeGenerator();
+    void init();                   // New random seed, visit counts cleared
+    void setSeed(uint32_t seed);   // Same seed + same moves = same maze
+    uint32_t getSeed() { return maze_seed; }
+
+    // Exit count range for generated cells (run-time tunable, kept across init())
+    void setExitRange(uint8_t min_count, uint8_t max_count);
+    uint8_t getMinExits() { return min_exits; }
+    uint8_t getMaxExits() { return max_exits; }
+
+    // Persistent maze (kept across init()); switching either rebuilds the walls
+    // from the current seed. Players keep the exits they already have: switch
+    // through GameState::setMazePersistent / setMazeAlgorithm mid-game
+    void setPersistent(bool on);
+    bool isPersistent() { return persistent; }
+    void setAlgorithm(uint8_t id);
+    uint8_t getAlgorithm() { return algorithm; }
+    const WallGrid& getWalls() { return walls; }
     
     // Returns exits for the CURRENT cell (where player is)
     uint8_t getCurrentDirections();
@@ -30,15 +67,32 @@ public:
     // Checks if direction is valid from CURRENT cell
     bool isDirectionValid(uint8_t x, uint8_t y, Direction dir);
     
-    // Regenerates exits for the given position (updates current_cell_dirs)
-    void generateNewDirections(uint8_t x, uint8_t y);
+    // Regenerates exits for the given position (updates current_cell_dirs):
+    // the next visit of this cell on `stream` (player index) decides them
+    void generateNewDirections(uint8_t x, uint8_t y, uint8_t stream = 0);
+
+    // The same in two halves, so a move can be worked out ahead of time:
+    // peek is what the next visit would get, commit makes that visit happen
+    uint8_t peekDirections(uint8_t x, uint8_t y, uint8_t stream) const;
+    void commitDirections(uint8_t x, uint8_t y, uint8_t stream, uint8_t dirs);
+
+    // Sides a path can leave a cell through: the carved maze in persistent mode;
+    // memoryless exits are re-rolled on entry, so every in-bounds side counts
+    uint8_t getPassages(uint8_t x, uint8_t y) const;
+    const MazeBits* getPassageBoards() const { return passages; }   // Same, as 4 bitboards
+    uint16_t getPassageVersion() const { return passage_version; }  // Changes with the boards
+
+    // Exits of one visit of a cell - pure, constant time, no rejection loop
+    uint8_t directionsFor(uint8_t x, uint8_t y, uint8_t stream, uint16_t visit) const;
     
     void setGoal(uint8_t gx, uint8_t gy);
     bool isGoal(uint8_t x, uint8_t y);
-    uint8_t getGoalX() { return goal_x; }
-    uint8_t getGoalY() { return goal_y; }
+    uint8_t getGoalX() const { return goal_x; }
+    uint8_t getGoalY() const { return goal_y; }
 
 private:
+    void buildWalls();         // Carve `walls` from maze_seed with `algorithm`
+    void loadPassageBoards();  // `passages` from `walls` or the grid borders
     bool isOutOfBounds(uint8_t x, uint8_t y, Direction dir);
 };
 
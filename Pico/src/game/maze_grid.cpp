@@ -0,0 +1,226 @@
+// game/maze_grid.cpp
+#include "maze_grid.h"
+#include "maze_generator.h"
+
+static const int8_t DIR_DX[4] = { 0, 1, 0, -1 };   // NORTH, EAST, SOUTH, WEST
+static const int8_t DIR_DY[4] = { -1, 0, 1, 0 };
+
+static inline uint8_t opposite(uint8_t dir) {
+    return (dir + 2) & 3;
+}
+
+// 2-bit fields in algorithm scratch (same packing as the grid)
+static inline uint8_t get2(const uint8_t* buf, uint32_t i) {
+    return (buf[i >> 2] >> ((i & 3) * 2)) & 0x03;
+}
+
+static inline void set2(uint8_t* buf, uint32_t i, uint8_t v) {
+    uint8_t shift = (i & 3) * 2;
+    buf[i >> 2] = (buf[i >> 2] & ~(0x03 << shift)) | (v << shift);
+}
+
+// Moves (x, y) one cell in `dir`; false (and unchanged) at the grid edge
+static inline bool step(const WallGrid& g, uint16_t& x, uint16_t& y, uint8_t dir) {
+    int32_t nx = x + DIR_DX[dir];
+    int32_t ny = y + DIR_DY[dir];
+    if (nx < 0 || ny < 0 || nx >= g.getWidth() || ny >= g.getHeight()) return false;
+    x = nx;
+    y = ny;
+    return true;
+}
+
+void WallGrid::clear() {
+    memset(bits, 0, storageBytes());
+}
+
+uint8_t WallGrid::openings(uint16_t x, uint16_t y) const {
+    uint32_t i = (uint32_t)y * width + x;
+    uint8_t own = cellBits(i);
+    uint8_t dirs = 0;
+    if (own & MAZE_PASSAGE_EAST)  dirs |= 1 << EAST;
+    if (own & MAZE_PASSAGE_SOUTH) dirs |= 1 << SOUTH;
+    if (x > 0 && (cellBits(i - 1) & MAZE_PASSAGE_EAST))      dirs |= 1 << WEST;
+    if (y > 0 && (cellBits(i - width) & MAZE_PASSAGE_SOUTH)) dirs |= 1 << NORTH;
+    return dirs;
+}
+
+void WallGrid::carve(uint16_t x, uint16_t y, uint8_t dir) {
+    // North/west walls belong to the neighbour
+    if (dir == NORTH) { y--; dir = SOUTH; }
+    if (dir == WEST)  { x--; dir = EAST; }
+    uint32_t i = (uint32_t)y * width + x;
+    bits[i >> 2] |= (dir == EAST ? MAZE_PASSAGE_EAST : MAZE_PASSAGE_SOUTH) << ((i & 3) * 2);
+}
+
+// ---------------------------------------------------------------------------
+// Recursive backtracker (iterative). Instead of a stack of cells, each visited
+// cell keeps the 2-bit direction back to the cell it was carved from, so the
+// walk retraces itself with a quarter byte per cell. A cell is visited once it
+// has any opening (or is the start).
+
+static uint32_t backtrackerScratch(uint16_t w, uint16_t h) {
+    return MAZE_GRID_BYTES(w, h);
+}
+
+static bool generateBacktracker(WallGrid& g, uint32_t seed, uint8_t* scratch) {
+    MazeRng rng(seed);
+    g.clear();
+
+    uint16_t sx = rng.below(g.getWidth());
+    uint16_t sy = rng.below(g.getHeight());
+    uint16_t x = sx, y = sy;
+
+    for (;;) {
+        uint8_t options[4];
+        uint8_t n = 0;
+        for (uint8_t d = 0; d < 4; d++) {
+            uint16_t nx = x, ny = y;
+            if (step(g, nx, ny, d) && g.openings(nx, ny) == 0 && !(nx == sx && ny == sy)) {
+                options[n++] = d;
+            }
+        }
+
+        if (n > 0) {
+            uint8_t d = options[rng.below(n)];
+            g.carve(x, y, d);
+            step(g, x, y, d);
+            set2(scratch, (uint32_t)y * g.getWidth() + x, opposite(d));
+        } else if (x == sx && y == sy) {
+            break;
+        } else {
+            step(g, x, y, get2(scratch, (uint32_t)y * g.getWidth() + x));
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Wilson's algorithm. From every cell not yet in the maze, random-walk until
+// the maze is hit, remembering only the last exit taken from each cell (2 bits)
+// - overwriting it erases loops - then carve the remembered path. Gives a
+// uniformly random spanning tree; first walks are long on big grids.
+
+static uint32_t wilsonScratch(uint16_t w, uint16_t h) {
+    return MAZE_GRID_BYTES(w, h);
+}
+
+static bool generateWilson(WallGrid& g, uint32_t seed, uint8_t* scratch) {
+    MazeRng rng(seed);
+    g.clear();
+
+    uint16_t w = g.getWidth();
+    uint32_t root = rng.below(g.cellCount());
+
+    for (uint32_t start = 0; start < g.cellCount(); start++) {
+        uint16_t x = start % w, y = start / w;
+        if (start == root || g.openings(x, y) != 0) continue;
+
+        // Walk until a cell already in the maze
+        while (!((uint32_t)y * w + x == root || g.openings(x, y) != 0)) {
+            uint8_t options[4];
+            uint8_t n = 0;
+            for (uint8_t d = 0; d < 4; d++) {
+                uint16_t nx = x, ny = y;
+                if (step(g, nx, ny, d)) options[n++] = d;
+            }
+            uint8_t d = options[rng.below(n)];
+            set2(scratch, (uint32_t)y * w + x, d);
+            step(g, x, y, d);
+        }
+
+        // Carve the loop-erased path from the start to where the walk ended
+        uint16_t ex = x, ey = y;
+        x = start % w;
+        y = start / w;
+        while (!(x == ex && y == ey)) {
+            uint8_t d = get2(scratch, (uint32_t)y * w + x);
+            g.carve(x, y, d);
+            step(g, x, y, d);
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Kruskal's algorithm. Walls are visited in a random order and opened when they
+// join two different trees (union-find, path halving). The order comes from a
+// 4-round Feistel permutation over the next even power of two above the wall
+// count, so no shuffled wall list is stored - only a uint16_t parent per cell,
+// which caps it at 65536 cells (256x256).
+
+static uint32_t kruskalScratch(uint16_t w, uint16_t h) {
+    return (uint32_t)w * h * sizeof(uint16_t);
+}
+
+static inline uint32_t findRoot(uint16_t* parent, uint32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static bool generateKruskal(WallGrid& g, uint32_t seed, uint8_t* scratch) {
+    uint32_t cells = g.cellCount();
+    if (cells > 65536) return false;
+
+    MazeRng rng(seed);
+    g.clear();
+
+    uint16_t w = g.getWidth();
+    uint16_t h = g.getHeight();
+    uint16_t* parent = (uint16_t*)scratch;   // Scratch must be 2-byte aligned
+    for (uint32_t i = 0; i < cells; i++) parent[i] = i;
+
+    // Walls 0..east_walls-1 are east walls, the rest south walls
+    uint32_t east_walls = (uint32_t)(w - 1) * h;
+    uint32_t walls = east_walls + (uint32_t)w * (h - 1);
+
+    uint8_t half = 1;
+    while ((1u << (2 * half)) < walls) half++;
+    uint32_t mask = (1u << half) - 1;
+    uint32_t key = rng.next();
+
+    uint32_t joined = 0;
+    for (uint32_t i = 0; i < (1u << (2 * half)) && joined + 1 < cells; i++) {
+        uint32_t l = i >> half, r = i & mask;
+        for (uint32_t round = 0; round < 4; round++) {
+            uint32_t f = mazeMix32((key + round * 0x9E3779B9u) ^ r) & mask;
+            uint32_t t = r;
+            r = l ^ f;
+            l = t;
+        }
+        uint32_t wall = (l << half) | r;
+        if (wall >= walls) continue;
+
+        uint16_t x, y;
+        uint8_t dir;
+        if (wall < east_walls) {
+            x = wall % (w - 1);
+            y = wall / (w - 1);
+            dir = EAST;
+        } else {
+            wall -= east_walls;
+            x = wall % w;
+            y = wall / w;
+            dir = SOUTH;
+        }
+
+        uint32_t a = (uint32_t)y * w + x;
+        uint32_t b = (dir == EAST) ? a + 1 : a + w;
+        uint32_t ra = findRoot(parent, a);
+        uint32_t rb = findRoot(parent, b);
+        if (ra != rb) {
+            parent[ra] = rb;
+            g.carve(x, y, dir);
+            joined++;
+        }
+    }
+    return true;
+}
+
+const MazeAlgorithm MAZE_ALGORITHMS[MAZE_ALGO_COUNT] = {
+    { "backtracker", backtrackerScratch, generateBacktracker },
+    { "wilson",      wilsonScratch,      generateWilson },
+    { "kruskal",     kruskalScratch,     generateKruskal },
+};
@@ -0,0 +1,87 @@
+// game/maze_grid.h
+// Persistent maze storage and generation algorithms.
+// WallGrid packs 2 bits per cell (passage east, passage south); a cell's
+// north/west passages are its neighbours' south/east bits. Storage and
+// algorithm scratch are caller-owned, so one code path serves the 8x7 game
+// grid and host-side grids hundreds of cells per side.
+#ifndef MAZE_GRID_H
+#define MAZE_GRID_H
+
+#include <Arduino.h>
+
+// Bytes of WallGrid storage for a w x h grid
+#define MAZE_GRID_BYTES(w, h)     (((uint32_t)(w) * (h) + 3) / 4)
+// Scratch large enough for any algorithm on a w x h grid (Kruskal's is largest)
+#define MAZE_SCRATCH_BYTES(w, h)  ((uint32_t)(w) * (h) * 2)
+
+#define MAZE_PASSAGE_EAST   0x01
+#define MAZE_PASSAGE_SOUTH  0x02
+
+// 32-bit integer finalizer (SplitMix-style xor-shift-multiply); two 32x32
+// multiplies, which the Cortex-M0+ does in a single cycle each
+static inline uint32_t mazeMix32(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Counter-based stream over mazeMix32: a seed always carves the same maze
+struct MazeRng {
+    uint32_t key;
+    uint32_t counter;
+
+    MazeRng() : key(0), counter(0) {}
+    explicit MazeRng(uint32_t seed) : key(mazeMix32(seed ^ 0x9E3779B9u)), counter(0) {}
+    uint32_t next() { return mazeMix32(key + counter++ * 0x9E3779B9u); }
+    // 0..n-1 by multiply-shift, no division
+    uint32_t below(uint32_t n) { return (uint32_t)(((uint64_t)next() * n) >> 32); }
+};
+
+class WallGrid {
+private:
+    uint8_t* bits;
+    uint16_t width, height;
+
+    uint8_t cellBits(uint32_t i) const { return (bits[i >> 2] >> ((i & 3) * 2)) & 0x03; }
+
+public:
+    WallGrid(uint8_t* storage, uint16_t w, uint16_t h) : bits(storage), width(w), height(h) {}
+
+    uint16_t getWidth() const { return width; }
+    uint16_t getHeight() const { return height; }
+    uint32_t cellCount() const { return (uint32_t)width * height; }
+    uint32_t storageBytes() const { return MAZE_GRID_BYTES(width, height); }
+
+    void clear();                                        // Every wall closed
+
+    // Open passages of a cell as a Direction bitfield (1 << NORTH ...)
+    uint8_t openings(uint16_t x, uint16_t y) const;
+    bool isOpen(uint16_t x, uint16_t y, uint8_t dir) const { return (openings(x, y) >> dir) & 1; }
+
+    // Opens the wall between (x, y) and its neighbour in `dir` (must be in bounds)
+    void carve(uint16_t x, uint16_t y, uint8_t dir);
+};
+
+// Pluggable generators: each clears the grid and carves a perfect maze
+// (exactly one path between any two cells). scratchBytes() is the working memory
+// generate() needs on top of the grid; generate() returns false if the grid
+// is beyond what the algorithm supports.
+enum MazeAlgorithmId {
+    MAZE_ALGO_BACKTRACKER,     // Long winding corridors, few dead ends
+    MAZE_ALGO_WILSON,          // Uniform spanning tree (loop-erased random walks)
+    MAZE_ALGO_KRUSKAL,         // Union-find over shuffled walls, many short dead ends
+    MAZE_ALGO_COUNT
+};
+
+struct MazeAlgorithm {
+    const char* name;
+    uint32_t (*scratchBytes)(uint16_t w, uint16_t h);
+    bool (*generate)(WallGrid& grid, uint32_t seed, uint8_t* scratch);
+};
+
+extern const MazeAlgorithm MAZE_ALGORITHMS[MAZE_ALGO_COUNT];
+
+#endif // MAZE_GRID_H
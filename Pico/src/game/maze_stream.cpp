@@ -0,0 +1,75 @@
+// game/maze_stream.cpp
+#include "maze_stream.h"
+#include "maze_generator.h"
+
+MazeStream::MazeStream() {
+    init(MAZE_WIDTH, 0);
+}
+
+void MazeStream::init(uint16_t w, uint32_t seed) {
+    width = (w > MAZE_STREAM_MAX_WIDTH) ? MAZE_STREAM_MAX_WIDTH : (w < 1 ? 1 : w);
+    rng = MazeRng(seed);
+    row_index = 0;
+    coin_left = 0;
+    memset(set_id, 0, sizeof(set_id));
+}
+
+bool MazeStream::coin() {
+    if (coin_left == 0) {
+        coin_bits = rng.next();
+        coin_left = 32;
+    }
+    coin_left--;
+    bool heads = coin_bits & 1;
+    coin_bits >>= 1;
+    return heads;
+}
+
+const uint8_t* MazeStream::nextRow(bool last) {
+    WallGrid row(row_bits, width, 1);
+    row.clear();
+
+    // Cells not entered from above start a set of their own. At most `width`
+    // labels are ever live, so 1..width always has a free one.
+    uint8_t members[MAZE_STREAM_MAX_WIDTH + 1] = { 0 };
+    for (uint16_t x = 0; x < width; x++) members[set_id[x]]++;
+    uint8_t next_free = 1;
+    for (uint16_t x = 0; x < width; x++) {
+        if (set_id[x] != 0) continue;
+        while (members[next_free] != 0) next_free++;
+        set_id[x] = next_free;
+        members[next_free] = 1;
+    }
+    members[0] = 0;
+
+    // Join neighbours from different sets - randomly, or all of them on the
+    // last row so the maze ends connected
+    for (uint16_t x = 0; x + 1 < width; x++) {
+        uint8_t a = set_id[x];
+        uint8_t b = set_id[x + 1];
+        if (a == b || !(last || coin())) continue;
+        row.carve(x, 0, EAST);
+        for (uint16_t i = 0; i < width; i++) {
+            if (set_id[i] == b) set_id[i] = a;
+        }
+        members[a] += members[b];
+        members[b] = 0;
+    }
+    row_index++;
+    if (last) return row_bits;
+
+    // Every set continues down through at least one cell: the last cell of a
+    // set that has not gone down yet is forced to
+    uint8_t went_down[MAZE_STREAM_MAX_WIDTH + 1] = { 0 };
+    for (uint16_t x = 0; x < width; x++) {
+        uint8_t s = set_id[x];
+        members[s]--;
+        if (coin() || (members[s] == 0 && !went_down[s])) {
+            row.carve(x, 0, SOUTH);
+            went_down[s] = 1;
+        } else {
+            set_id[x] = 0;
+        }
+    }
+    return row_bits;
+}
@@ -0,0 +1,38 @@
+// game/maze_stream.h
+// Endless maze, one row at a time (Eller's algorithm). Only the current row's
+// set labels are kept, so memory is O(width) however many rows are produced,
+// and every prefix of rows is part of a perfect maze.
+#ifndef MAZE_STREAM_H
+#define MAZE_STREAM_H
+
+#include <Arduino.h>
+#include "maze_grid.h"
+
+#define MAZE_STREAM_MAX_WIDTH  64
+#define MAZE_STREAM_ROW_BYTES  MAZE_GRID_BYTES(MAZE_STREAM_MAX_WIDTH, 1)
+
+class MazeStream {
+private:
+    uint16_t width;
+    MazeRng rng;
+    uint32_t row_index;                          // Rows produced so far
+    uint8_t set_id[MAZE_STREAM_MAX_WIDTH];       // Set of each cell in the next row; 0 = new
+    uint8_t row_bits[MAZE_STREAM_ROW_BYTES];     // Last row, packed like WallGrid
+    uint32_t coin_bits;                          // Cached random bits for the 50/50 choices
+    uint8_t coin_left;
+
+    bool coin();
+
+public:
+    MazeStream();
+    void init(uint16_t w, uint32_t seed);        // Same seed = same rows
+
+    // Carves the next row: 2 bits per cell (MAZE_PASSAGE_EAST / _SOUTH), valid
+    // until the next call. last = true closes the maze (no south passages).
+    const uint8_t* nextRow(bool last = false);
+
+    uint16_t getWidth() const { return width; }
+    uint32_t getRowIndex() const { return row_index; }
+};
+
+#endif // MAZE_STREAM_H
@@ -0,0 +1,109 @@
+// game/maze_world.cpp
+#include "maze_world.h"
+#include "maze_generator.h"
+#include "../serial_log.h"
+
+MazeWorld::MazeWorld() {
+    init(0, 1, 1);
+}
+
+void MazeWorld::init(uint32_t seed, uint16_t w, uint16_t h, uint8_t algo) {
+    chunks_w = (w < 1) ? 1 : w;        // cx <= 0xFFFE, never MAZE_CHUNK_NONE
+    chunks_h = (h < 1) ? 1 : h;
+    seed_key = mazeMix32(seed ^ 0x9E3779B9u);
+    algorithm = (algo < MAZE_ALGO_COUNT) ? algo : (uint8_t)MAZE_ALGORITHM;
+    for (uint8_t i = 0; i < MAZE_CHUNK_CACHE; i++) {
+        chunks[i].cx = MAZE_CHUNK_NONE;
+        chunks[i].last_used = 0;
+    }
+    last = &chunks[0];
+    clock = 0;
+    hits = 0;
+    misses = 0;
+    carve_us = 0;
+}
+
+bool MazeWorld::doorOf(uint16_t cx, uint16_t cy, bool* west, uint8_t* offset) const {
+    if (cx == 0 && cy == 0) return false;
+    uint32_t h = mazeMix32(seed_key ^ ((uint32_t)cy << 16 | cx));
+    // Binary tree over chunks: west or north, whichever exists if only one does
+    *west = (cy == 0) || (cx > 0 && (h & 1));
+    *offset = (h >> 1) & (MAZE_CHUNK_SIZE - 1);
+    return true;
+}
+
+MazeChunk* MazeWorld::chunkAt(uint16_t cx, uint16_t cy) {
+    clock++;
+    if (last->cx == cx && last->cy == cy) {
+        // Walks and viewports stay in one chunk most of the time
+        last->last_used = clock;
+        hits++;
+        return last;
+    }
+
+    // Linear scan, as in SpriteCache: the table is small
+    MazeChunk* victim = &chunks[0];
+    for (uint8_t i = 0; i < MAZE_CHUNK_CACHE; i++) {
+        MazeChunk* c = &chunks[i];
+        if (c->cx == cx && c->cy == cy) {
+            c->last_used = clock;
+            hits++;
+            last = c;
+            return c;
+        }
+        if (c->last_used < victim->last_used) victim = c;  // Free slots are stamped 0
+    }
+
+    misses++;
+    uint32_t t0 = micros();
+    WallGrid grid(victim->bits, MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE);
+    MAZE_ALGORITHMS[algorithm].generate(grid, mazeMix32(seed_key + ((uint32_t)cy << 16 | cx)),
+                                        (uint8_t*)scratch);
+    carve_us += micros() - t0;
+
+    victim->cx = cx;
+    victim->cy = cy;
+    victim->last_used = clock;
+    last = victim;
+    return victim;
+}
+
+uint8_t MazeWorld::openings(uint32_t x, uint32_t y) {
+    if (x >= getWidth() || y >= getHeight()) return 0;
+    uint16_t cx = x >> MAZE_CHUNK_SHIFT, cy = y >> MAZE_CHUNK_SHIFT;
+    uint8_t lx = x & (MAZE_CHUNK_SIZE - 1), ly = y & (MAZE_CHUNK_SIZE - 1);
+
+    MazeChunk* chunk = chunkAt(cx, cy);
+    uint8_t dirs = WallGrid(chunk->bits, MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE).openings(lx, ly);
+
+    // Doors on the chunk's edges: its own (west / north) and the ones its
+    // east and south neighbours open into it
+    bool west;
+    uint8_t offset;
+    if ((lx == 0 || ly == 0) && doorOf(cx, cy, &west, &offset)) {
+        if (west && lx == 0 && offset == ly) dirs |= 1 << WEST;
+        if (!west && ly == 0 && offset == lx) dirs |= 1 << NORTH;
+    }
+    if (lx == MAZE_CHUNK_SIZE - 1 && cx + 1 < chunks_w &&
+        doorOf(cx + 1, cy, &west, &offset) && west && offset == ly) {
+        dirs |= 1 << EAST;
+    }
+    if (ly == MAZE_CHUNK_SIZE - 1 && cy + 1 < chunks_h &&
+        doorOf(cx, cy + 1, &west, &offset) && !west && offset == lx) {
+        dirs |= 1 << SOUTH;
+    }
+    return dirs;
+}
+
+void MazeWorld::printStats() {
+    uint32_t total = hits + misses;
+    Log.print("[WORLD] Chunk hits ");
+    Log.print(hits);
+    Log.print(", misses ");
+    Log.print(misses);
+    Log.print(" (");
+    Log.print(total ? (uint32_t)((uint64_t)hits * 100 / total) : 0);
+    Log.print("% hit), ");
+    Log.print(misses ? carve_us / misses : 0);
+    Log.println(" us per chunk carved");
+}
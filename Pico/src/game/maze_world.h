@@ -0,0 +1,65 @@
+// game/maze_world.h
+// Persistent maze far larger than SRAM, split into square chunks of
+// MAZE_CHUNK_SIZE cells. A chunk is carved from (seed, chunk position) with
+// one of the MazeAlgorithmId generators the first time it is needed and kept
+// in a small LRU cache; an evicted chunk is simply carved again, identically,
+// next time. Doors between chunks are a pure hash of the seed, so a chunk
+// never needs its neighbours loaded: every chunk but (0, 0) opens one door
+// into its west or north neighbour, which makes the chunks a spanning tree
+// and the whole world a perfect maze.
+#ifndef MAZE_WORLD_H
+#define MAZE_WORLD_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "maze_grid.h"
+
+#define MAZE_CHUNK_SIZE         (1 << MAZE_CHUNK_SHIFT)
+#define MAZE_CHUNK_BYTES        MAZE_GRID_BYTES(MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE)
+#define MAZE_CHUNK_NONE         0xFFFF
+
+// One carved chunk in the cache
+struct MazeChunk {
+    uint16_t cx, cy;                       // Chunk position, cx = MAZE_CHUNK_NONE for a free slot
+    uint32_t last_used;                    // LRU stamp
+    uint8_t bits[MAZE_CHUNK_BYTES];        // WallGrid storage
+};
+
+class MazeWorld {
+private:
+    MazeChunk chunks[MAZE_CHUNK_CACHE];
+    uint16_t scratch[(MAZE_SCRATCH_BYTES(MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE) + 1) / 2];  // 2-byte aligned
+    uint16_t chunks_w, chunks_h;           // World size in chunks
+    uint32_t seed_key;
+    uint8_t algorithm;
+    MazeChunk* last;                       // Chunk of the previous lookup
+
+    uint32_t clock;
+    uint32_t hits, misses;
+    uint32_t carve_us;                     // Total time spent carving on misses
+
+    MazeChunk* chunkAt(uint16_t cx, uint16_t cy);
+    // Door from chunk (cx, cy) into its west (true) or north neighbour, at
+    // *offset along the shared edge; false for chunk (0, 0)
+    bool doorOf(uint16_t cx, uint16_t cy, bool* west, uint8_t* offset) const;
+
+public:
+    MazeWorld();
+
+    // World of w x h chunks; drops the cache and zeroes the counters
+    void init(uint32_t seed, uint16_t w, uint16_t h, uint8_t algo = MAZE_ALGORITHM);
+
+    uint32_t getWidth() const { return (uint32_t)chunks_w << MAZE_CHUNK_SHIFT; }
+    uint32_t getHeight() const { return (uint32_t)chunks_h << MAZE_CHUNK_SHIFT; }
+
+    // Open passages of cell (x, y) as a Direction bitfield, carving its chunk
+    // on a cache miss
+    uint8_t openings(uint32_t x, uint32_t y);
+
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }        // = chunks carved
+    uint32_t getCarveMicros() const { return carve_us; }
+    void printStats();
+};
+
+#endif // MAZE_WORLD_H
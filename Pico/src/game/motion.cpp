@@ -0,0 +1,65 @@
+// game/motion.cpp
+// Fixed-point tween implementation
+#include "motion.h"
+
+void Motion::snapTo(MotionTween* tween, int16_t x, int16_t y) {
+    tween->from_x = tween->to_x = (int32_t)x << 8;
+    tween->from_y = tween->to_y = (int32_t)y << 8;
+    tween->start_ms = 0;
+    tween->duration_ms = 0;
+    tween->curve = EASE_LINEAR;
+}
+
+void Motion::moveTo(MotionTween* tween, int16_t x, int16_t y, uint16_t duration_ms,
+                    EaseCurve curve, uint32_t now) {
+    // Start from wherever we are now so back-to-back moves never jump
+    int32_t cx, cy;
+    getPositionQ8(tween, now, &cx, &cy);
+
+    tween->from_x = cx;
+    tween->from_y = cy;
+    tween->to_x = (int32_t)x << 8;
+    tween->to_y = (int32_t)y << 8;
+    tween->start_ms = now;
+    tween->duration_ms = duration_ms;
+    tween->curve = curve;
+}
+
+bool Motion::isMoving(const MotionTween* tween, uint32_t now) {
+    return tween->duration_ms != 0 && (now - tween->start_ms) < tween->duration_ms;
+}
+
+void Motion::getPosition(const MotionTween* tween, uint32_t now, int16_t* x, int16_t* y) {
+    int32_t qx, qy;
+    getPositionQ8(tween, now, &qx, &qy);
+    *x = (int16_t)((qx + 128) >> 8);
+    *y = (int16_t)((qy + 128) >> 8);
+}
+
+int32_t Motion::ease(EaseCurve curve, int32_t t) {
+    switch (curve) {
+        case EASE_OUT_QUAD: {
+            int32_t inv = 256 - t;
+            return 256 - ((inv * inv) >> 8);
+        }
+        case EASE_IN_OUT:
+            return (t * t * (768 - 2 * t)) >> 16;
+        case EASE_LINEAR:
+        default:
+            return t;
+    }
+}
+
+void Motion::getPositionQ8(const MotionTween* tween, uint32_t now, int32_t* x, int32_t* y) {
+    uint32_t elapsed = now - tween->start_ms;
+    if (tween->duration_ms == 0 || elapsed >= tween->duration_ms) {
+        *x = tween->to_x;
+        *y = tween->to_y;
+        return;
+    }
+
+    int32_t t = (int32_t)((elapsed << 8) / tween->duration_ms);  // Q8 progress
+    int32_t e = ease(tween->curve, t);
+    *x = tween->from_x + (((tween->to_x - tween->from_x) * e) >> 8);
+    *y = tween->from_y + (((tween->to_y - tween->from_y) * e) >> 8);
+}
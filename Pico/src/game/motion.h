@@ -0,0 +1,43 @@
+// game/motion.h
+// Fixed-point tweening for on-screen movement (game logic stays cell-based)
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <Arduino.h>
+
+// Easing curves, evaluated in Q8 (0..256)
+enum EaseCurve {
+    EASE_LINEAR,
+    EASE_OUT_QUAD,     // Fast start, soft landing
+    EASE_IN_OUT        // Smoothstep
+};
+
+// Sub-pixel position animating between two pixel positions
+struct MotionTween {
+    int32_t from_x, from_y;   // Q8.8 pixels
+    int32_t to_x, to_y;       // Q8.8 pixels
+    uint32_t start_ms;        // millis() when the tween started
+    uint16_t duration_ms;     // 0 = already at target
+    EaseCurve curve;
+};
+
+class Motion {
+public:
+    // Jump to a pixel position with no animation
+    static void snapTo(MotionTween* tween, int16_t x, int16_t y);
+
+    // Start animating from the current (possibly mid-tween) position to x,y
+    static void moveTo(MotionTween* tween, int16_t x, int16_t y, uint16_t duration_ms,
+                       EaseCurve curve, uint32_t now);
+
+    static bool isMoving(const MotionTween* tween, uint32_t now);
+
+    // Current position rounded to whole pixels
+    static void getPosition(const MotionTween* tween, uint32_t now, int16_t* x, int16_t* y);
+
+private:
+    static int32_t ease(EaseCurve curve, int32_t t);  // t and result in Q8
+    static void getPositionQ8(const MotionTween* tween, uint32_t now, int32_t* x, int32_t* y);
+};
+
+#endif // MOTION_H
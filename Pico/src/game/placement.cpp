@@ -0,0 +1,93 @@
+// game/placement.cpp
+#include "placement.h"
+
+DistanceField::DistanceField() {
+    memset(dist, PLACE_UNREACHABLE, sizeof(dist));
+    candidates = 0;
+    max_dist = 0;
+}
+
+void DistanceField::build(const MazeGenerator& maze, const uint8_t* sources, uint8_t count, uint64_t exclude) {
+    // Distance rings by bitboard flood fill: one shift-and-mask step per ring
+    MazeBits from;
+    for (uint8_t i = 0; i < count; i++) from.set(sources[i]);
+    MazeBits rings[MAZE_CELLS];
+    uint32_t ring_count = floodFill(maze.getPassageBoards(), from, (MazeBits*)nullptr, rings, MAZE_CELLS);
+
+    // Rings are already sorted by distance: walk them into the buckets
+    memset(dist, PLACE_UNREACHABLE, sizeof(dist));
+    candidates = 0;
+    max_dist = 0;
+    for (uint8_t d = 0; d < ring_count; d++) {
+        at_least[d] = candidates;
+        uint64_t ring = rings[d].w[0];
+        if (ring & ~exclude) max_dist = d;
+        while (ring) {
+            uint8_t cell = __builtin_ctzll(ring);
+            ring &= ring - 1;
+            dist[cell] = d;
+            if (!(exclude & (1ULL << cell))) by_dist[candidates++] = cell;
+        }
+    }
+    for (uint32_t d = ring_count; d <= MAZE_CELLS; d++) at_least[d] = candidates;
+}
+
+bool DistanceField::pick(uint8_t min_dist, uint8_t* x, uint8_t* y) const {
+    if (candidates == 0) return false;
+    if (min_dist > max_dist) min_dist = max_dist;
+
+    uint8_t first = at_least[min_dist];
+    uint8_t cell = by_dist[first + random(0, candidates - first)];
+    *x = cell % MAZE_WIDTH;
+    *y = cell / MAZE_WIDTH;
+    return true;
+}
+
+GoalDistances::GoalDistances() {
+    memset(dist, PLACE_UNREACHABLE, sizeof(dist));
+    player_dist[0] = player_dist[1] = PLACE_UNREACHABLE;
+    goal_cell = PLACE_UNREACHABLE;
+    passage_version = 0;
+}
+
+bool GoalDistances::refresh(const MazeGenerator& maze) {
+    uint8_t goal = maze.getGoalY() * MAZE_WIDTH + maze.getGoalX();
+    if (goal == goal_cell && maze.getPassageVersion() == passage_version) return false;
+    goal_cell = goal;
+    passage_version = maze.getPassageVersion();
+    build(maze);
+    return true;
+}
+
+void GoalDistances::build(const MazeGenerator& maze) {
+    // Passages are two-way, so rings out of the goal are distances into it
+    MazeBits rings[MAZE_CELLS];
+    uint32_t ring_count = floodFill(maze.getPassageBoards(), MazeBits::cell(goal_cell),
+                                    (MazeBits*)nullptr, rings, MAZE_CELLS);
+    memset(dist, PLACE_UNREACHABLE, sizeof(dist));
+    for (uint8_t d = 0; d < ring_count; d++) {
+        uint64_t ring = rings[d].w[0];
+        while (ring) {
+            dist[__builtin_ctzll(ring)] = d;
+            ring &= ring - 1;
+        }
+    }
+}
+
+void GoalDistances::updatePlayer(uint8_t id, uint8_t x, uint8_t y, uint8_t exits) {
+    uint8_t cell = y * MAZE_WIDTH + x;
+    if (cell == goal_cell) {
+        player_dist[id] = 0;
+        return;
+    }
+    // The player's own cell is the one place the field's passages may not
+    // apply: only the exits it actually has lead on
+    uint8_t best = PLACE_UNREACHABLE;
+    static const int8_t offset[4] = { -MAZE_WIDTH, 1, MAZE_WIDTH, -1 };
+    for (uint8_t d = 0; d < 4; d++) {
+        if (!(exits & (1 << d)) || !MAZE_CAN_STEP[d].test(cell)) continue;
+        uint8_t next = dist[cell + offset[d]];
+        if (next < best) best = next;
+    }
+    player_dist[id] = (best == PLACE_UNREACHABLE) ? PLACE_UNREACHABLE : best + 1;
+}
@@ -0,0 +1,70 @@
+// game/placement.h
+// Spawn and goal placement by path distance instead of rejection sampling.
+// A multi-source bitboard flood fill (bitboard.h) gives the rings of cells
+// 0, 1, 2... moves from the nearest source; laid out ring by ring, a random
+// cell at least d moves away is a single random() into a contiguous range.
+// Cells the flood fill cannot reach are never candidates.
+#ifndef PLACEMENT_H
+#define PLACEMENT_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "maze_generator.h"
+
+#define PLACE_UNREACHABLE  0xFF
+
+class DistanceField {
+private:
+    uint8_t dist[MAZE_CELLS];              // Moves to the nearest source
+    uint8_t by_dist[MAZE_CELLS];           // Candidate cells, nearest first
+    uint8_t at_least[MAZE_CELLS + 1];      // by_dist index of the first candidate >= d away
+    uint8_t candidates;
+    uint8_t max_dist;                      // Farthest candidate
+
+public:
+    DistanceField();
+
+    // Flood fill from `count` source cells (cell = y * MAZE_WIDTH + x) along
+    // MazeGenerator::getPassageBoards(); cells in `exclude` are walked
+    // through but never picked
+    void build(const MazeGenerator& maze, const uint8_t* sources, uint8_t count, uint64_t exclude);
+
+    uint8_t distanceAt(uint8_t x, uint8_t y) const { return dist[y * MAZE_WIDTH + x]; }
+    uint8_t getMaxDistance() const { return max_dist; }
+
+    // Uniform random candidate at least min_dist moves from every source, or
+    // from the farthest bucket if none is that far. O(1); false only when
+    // there is no candidate at all.
+    bool pick(uint8_t min_dist, uint8_t* x, uint8_t* y) const;
+};
+
+// Path distance from each player to the goal, for the goal's heat-map tint.
+// The field (moves to the goal from every cell, through passable sides) is
+// flood-filled only when the goal moves or the maze's passages change. A
+// player's distance is 1 + the nearest neighbour it has an exit to, so a move
+// that re-rolls the mover's exits refreshes one entry in O(4), and a frame
+// reads the cached value.
+class GoalDistances {
+private:
+    uint8_t dist[MAZE_CELLS];              // Moves from each cell to the goal
+    uint8_t player_dist[2];
+    uint8_t goal_cell;                     // Goal the field was built for (PLACE_UNREACHABLE = none)
+    uint16_t passage_version;              // MazeGenerator::getPassageVersion() it was built for
+
+    void build(const MazeGenerator& maze);
+
+public:
+    GoalDistances();
+
+    void invalidate() { goal_cell = PLACE_UNREACHABLE; }
+    // Rebuilds the field if the goal or the passages changed since the last
+    // build; true if it did (every player entry is then stale)
+    bool refresh(const MazeGenerator& maze);
+
+    // Player `id` stands at (x, y) and can leave through `exits` (Direction bits)
+    void updatePlayer(uint8_t id, uint8_t x, uint8_t y, uint8_t exits);
+    uint8_t getPlayerDistance(uint8_t id) const { return player_dist[id]; }
+    uint8_t distanceAt(uint8_t x, uint8_t y) const { return dist[y * MAZE_WIDTH + x]; }
+};
+
+#endif // PLACEMENT_H
@@ -0,0 +1,83 @@
+// game/scrolling_maze.cpp
+#include "scrolling_maze.h"
+
+static const int16_t BAND_X = (MATRIX_WIDTH - (ATTRACT_MAZE_COLS * ATTRACT_CELL_SIZE + 1)) / 2;
+
+static inline uint8_t passages(const uint8_t* row, uint16_t c) {
+    return (row[c >> 2] >> ((c & 3) * 2)) & 0x03;
+}
+
+ScrollingMaze::ScrollingMaze() {
+    init(0);
+}
+
+void ScrollingMaze::init(uint32_t seed) {
+    stream.init(ATTRACT_MAZE_COLS, seed);
+    generated = 0;
+    top_px = 0;
+    last_step_ms = millis();
+    drawn = false;
+}
+
+const uint8_t* ScrollingMaze::mazeRow(uint32_t r) {
+    while (generated <= r) {
+        memcpy(rows[generated % ATTRACT_RING_ROWS], stream.nextRow(), MAZE_STREAM_ROW_BYTES);
+        generated++;
+    }
+    return rows[r % ATTRACT_RING_ROWS];
+}
+
+void ScrollingMaze::drawPixelRow(DisplayManager* display, uint32_t p) {
+    uint32_t r = p / ATTRACT_CELL_SIZE;
+    uint8_t k = p % ATTRACT_CELL_SIZE;
+    int16_t y = ATTRACT_MAZE_Y + p % ATTRACT_BAND_PX;
+
+    // Each cell owns its top-left corner, top wall and left wall; bit 63 = BAND_X
+    uint64_t mask = 0;
+    uint64_t cell_top = ~0ULL << (64 - ATTRACT_CELL_SIZE);
+    if (k == 0) {
+        const uint8_t* above = (r > 0) ? mazeRow(r - 1) : nullptr;
+        for (uint16_t c = 0; c < ATTRACT_MAZE_COLS; c++) {
+            bool open = above && (passages(above, c) & MAZE_PASSAGE_SOUTH);
+            mask |= (open ? 1ULL << 63 : cell_top) >> (c * ATTRACT_CELL_SIZE);
+        }
+    } else {
+        const uint8_t* row = mazeRow(r);
+        for (uint16_t c = 0; c < ATTRACT_MAZE_COLS; c++) {
+            bool open = c > 0 && (passages(row, c - 1) & MAZE_PASSAGE_EAST);
+            if (!open) mask |= (1ULL << 63) >> (c * ATTRACT_CELL_SIZE);
+        }
+    }
+    mask |= (1ULL << 63) >> (ATTRACT_MAZE_COLS * ATTRACT_CELL_SIZE);   // Right edge
+
+    display->fillRect(0, y, MATRIX_WIDTH, 1, 0x0000);
+    display->drawRowMask(BAND_X, y, mask, ATTRACT_WALL_COLOR);
+}
+
+void ScrollingMaze::render(DisplayManager* display, uint32_t now) {
+    if (!drawn) last_step_ms = now;     // Resume where it stopped
+    uint32_t steps = (now - last_step_ms) / ATTRACT_SCROLL_MS;
+    last_step_ms += steps * ATTRACT_SCROLL_MS;
+
+    if (drawn && steps < ATTRACT_BAND_PX) {
+        // Incoming rows only: each lands in the slot the top row just vacated
+        for (uint32_t i = 0; i < steps; i++) {
+            top_px++;
+            drawPixelRow(display, top_px + ATTRACT_BAND_PX - 1);
+        }
+    } else {
+        top_px += steps;
+        for (uint32_t p = top_px; p < top_px + ATTRACT_BAND_PX; p++) {
+            drawPixelRow(display, p);
+        }
+        drawn = true;
+    }
+
+    display->setScroll(ATTRACT_MAZE_Y, ATTRACT_BAND_PX, top_px % ATTRACT_BAND_PX);
+}
+
+void ScrollingMaze::stop(DisplayManager* display) {
+    if (!drawn) return;
+    display->setScroll(0, 0, 0);
+    drawn = false;
+}
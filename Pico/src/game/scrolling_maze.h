@@ -0,0 +1,43 @@
+// game/scrolling_maze.h
+// Endless maze scrolling up through a band of the panel (start screen
+// backdrop). The driver does the scrolling (DisplayManager::setScroll); per
+// step only the pixel row coming in at the bottom is drawn, into the
+// framebuffer row that just left the top, and MazeStream carves a new maze row
+// every ATTRACT_CELL_SIZE steps.
+#ifndef SCROLLING_MAZE_H
+#define SCROLLING_MAZE_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "../display/display_manager.h"
+#include "maze_stream.h"
+
+#define ATTRACT_MAZE_COLS   ((MATRIX_WIDTH - 1) / ATTRACT_CELL_SIZE)   // Room for the right wall
+#define ATTRACT_BAND_PX     (ATTRACT_MAZE_ROWS * ATTRACT_CELL_SIZE)
+#define ATTRACT_RING_ROWS   (ATTRACT_MAZE_ROWS + 2)   // Visible + partly visible + the one above
+
+class ScrollingMaze {
+private:
+    MazeStream stream;
+    uint8_t rows[ATTRACT_RING_ROWS][MAZE_STREAM_ROW_BYTES];  // Recent maze rows, by row % ring
+    uint32_t generated;        // Maze rows carved so far
+    uint32_t top_px;           // Maze pixel row at the top of the band
+    uint32_t last_step_ms;
+    bool drawn;                // Band in the framebuffer matches top_px
+
+    const uint8_t* mazeRow(uint32_t r);                     // Carves up to row r
+    void drawPixelRow(DisplayManager* display, uint32_t p); // Maze pixel row p into its ring slot
+
+public:
+    ScrollingMaze();
+    void init(uint32_t seed);
+
+    // Advances by the time elapsed and sets the driver scroll; the whole band
+    // is redrawn only after stop() or a stall of a band height of steps
+    void render(DisplayManager* display, uint32_t now);
+
+    // Scrolling off; the band must be redrawn once the framebuffer was cleared
+    void stop(DisplayManager* display);
+};
+
+#endif // SCROLLING_MAZE_H
@@ -0,0 +1,202 @@
+// input/console.cpp
+// Console command parsing and frame statistics
+#include "console.h"
+#include "../serial_log.h"
+
+Console::Console() {
+    param_count = 0;
+    line_len = 0;
+    line_overflow = false;
+    last = { 0, 0, 0 };
+    have_last = false;
+    memset(acks, 0, sizeof(acks));
+    report_param = -1;
+    report_old_value = 0;
+    refresh_count = nullptr;
+    restartWindow();
+}
+
+bool Console::addParam(const char* name, int32_t min_value, int32_t max_value,
+                       int32_t (*get)(), void (*set)(int32_t value)) {
+    if (param_count >= CONSOLE_MAX_PARAMS) return false;
+    params[param_count++] = { name, min_value, max_value, get, set };
+    return true;
+}
+
+void Console::feed(char c) {
+    if (c == '\r' || c == '\n') {
+        if (line_len == 0) return;  // Second half of CRLF
+        line[line_len] = '\0';
+        if (line_overflow) {
+            Log.println("[CON] Line too long");
+        } else {
+            execute();
+        }
+        line_len = 0;
+        line_overflow = false;
+        return;
+    }
+
+    if (line_len < CONSOLE_LINE_LEN - 1) {
+        line[line_len++] = c;
+    } else {
+        line_overflow = true;
+    }
+}
+
+const ConsoleParam* Console::find(const char* name, int8_t* index) {
+    for (uint8_t i = 0; i < param_count; i++) {
+        if (strcmp(params[i].name, name) == 0) {
+            if (index) *index = i;
+            return &params[i];
+        }
+    }
+    Log.print("[CON] Unknown parameter: ");
+    Log.println(name);
+    return nullptr;
+}
+
+void Console::execute() {
+    // Split ":cmd [name [value]]" in place
+    char* words[3] = { nullptr, nullptr, nullptr };
+    uint8_t count = 0;
+    char* p = line + 1;  // Skip ':'
+    while (*p && count < 3) {
+        while (*p == ' ') *p++ = '\0';
+        if (!*p) break;
+        words[count++] = p;
+        while (*p && *p != ' ') p++;
+    }
+    if (*p) *p = '\0';
+    if (count == 0) return;
+
+    const char* cmd = words[0];
+    if (strcmp(cmd, "list") == 0) {
+        for (uint8_t i = 0; i < param_count; i++) printParam(params[i]);
+    } else if (strcmp(cmd, "get") == 0 && count == 2) {
+        const ConsoleParam* param = find(words[1], nullptr);
+        if (param) printParam(*param);
+    } else if (strcmp(cmd, "set") == 0 && count == 3) {
+        int8_t index;
+        const ConsoleParam* param = find(words[1], &index);
+        if (!param) return;
+
+        char* end;
+        long value = strtol(words[2], &end, 0);
+        if (*end != '\0' || value < param->min_value || value > param->max_value) {
+            Log.print("[CON] ");
+            Log.print(param->name);
+            Log.print(" takes ");
+            Log.print(param->min_value);
+            Log.print("..");
+            Log.println(param->max_value);
+            return;
+        }
+
+        // Baseline is the last full window; the effect is measured on the
+        // first window that starts after the change
+        report_old_value = param->get();
+        param->set((int32_t)value);
+        report_param = index;
+        report_before = last;
+        printParam(*param);
+        restartWindow();
+    } else if (strcmp(cmd, "stats") == 0) {
+        if (have_last) {
+            Log.print("[CON] ");
+            printStats(last);
+            Log.println();
+        } else {
+            Log.println("[CON] No full window yet");
+        }
+        printAcks("prepared", acks[1]);
+        printAcks("on arrival", acks[0]);
+    } else {
+        Log.println("[CON] Commands: :list  :get NAME  :set NAME VALUE  :stats");
+    }
+}
+
+void Console::printParam(const ConsoleParam& p) {
+    Log.print("[CON] ");
+    Log.print(p.name);
+    Log.print(" = ");
+    Log.print(p.get());
+    Log.print("  (");
+    Log.print(p.min_value);
+    Log.print("..");
+    Log.print(p.max_value);
+    Log.println(")");
+}
+
+void Console::printStats(const FrameStats& s) {
+    Log.print("frame ");
+    Log.print(s.frame_us);
+    Log.print(" us, ");
+    Log.print(s.fps_x10 / 10);
+    Log.print(".");
+    Log.print(s.fps_x10 % 10);
+    Log.print(" fps, refresh ");
+    Log.print(s.refresh_hz);
+    Log.print(" Hz");
+}
+
+void Console::printAcks(const char* label, const AckStats& a) {
+    Log.print("[CON] ack ");
+    Log.print(label);
+    Log.print(": ");
+    Log.print(a.count);
+    Log.print(" moves");
+    if (a.count > 0) {
+        Log.print(", ");
+        Log.print(a.total_us / a.count);
+        Log.print(" us avg, ");
+        Log.print(a.max_us);
+        Log.print(" us max");
+    }
+    Log.println();
+}
+
+void Console::onMoveAck(uint32_t latency_us, bool prepared) {
+    AckStats& a = acks[prepared ? 1 : 0];
+    a.count++;
+    a.total_us += latency_us;
+    if (latency_us > a.max_us) a.max_us = latency_us;
+}
+
+void Console::restartWindow() {
+    window_frames = 0;
+    window_busy_us = 0;
+    window_start_us = micros();
+    window_start_refresh = refresh_count ? refresh_count() : 0;
+}
+
+void Console::onFrame(uint32_t busy_us) {
+    window_frames++;
+    window_busy_us += busy_us;
+    if (window_frames < CONSOLE_STATS_FRAMES) return;
+
+    uint32_t elapsed_us = micros() - window_start_us;
+    if (elapsed_us == 0) elapsed_us = 1;
+    uint32_t refreshes = refresh_count ? refresh_count() - window_start_refresh : 0;
+    last.frame_us = window_busy_us / window_frames;
+    last.fps_x10 = (uint32_t)((uint64_t)window_frames * 10000000ULL / elapsed_us);
+    last.refresh_hz = (uint32_t)((uint64_t)refreshes * 1000000ULL / elapsed_us);
+    have_last = true;
+    restartWindow();
+
+    if (report_param >= 0) {
+        const ConsoleParam& p = params[report_param];
+        Log.print("[CON] ");
+        Log.print(p.name);
+        Log.print(" ");
+        Log.print(report_old_value);
+        Log.print(" -> ");
+        Log.print(p.get());
+        Log.print(": ");
+        printStats(report_before);
+        Log.print("  ->  ");
+        printStats(last);
+        Log.println();
+        report_param = -1;
+    }
+}
@@ -0,0 +1,91 @@
+// input/console.h
+// Line-oriented tuning console on USB serial. Lines start with ':' so they
+// never collide with SerialInput's single-key commands:
+//   :list              every parameter with its value and range
+//   :get NAME          one parameter
+//   :set NAME VALUE    change it now, then report frame time / refresh rate
+//   :stats             current frame time, frame rate and panel refresh rate,
+//                      and move acknowledgement latency
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <Arduino.h>
+#include "../config.h"
+
+// Named run-time parameter; get/set talk straight to the owning object
+struct ConsoleParam {
+    const char* name;
+    int32_t min_value;
+    int32_t max_value;
+    int32_t (*get)();
+    void (*set)(int32_t value);
+};
+
+// Averages over one CONSOLE_STATS_FRAMES window
+struct FrameStats {
+    uint32_t frame_us;      // Mean update + render time per frame
+    uint32_t fps_x10;       // Frames rendered per second, x10
+    uint32_t refresh_hz;    // Full panel refreshes per second (0 if unknown)
+};
+
+// Move acknowledgements since boot: input decoded -> ack byte written
+struct AckStats {
+    uint32_t count;
+    uint32_t total_us;
+    uint32_t max_us;
+};
+
+class Console {
+private:
+    ConsoleParam params[CONSOLE_MAX_PARAMS];
+    uint8_t param_count;
+
+    char line[CONSOLE_LINE_LEN];
+    uint8_t line_len;
+    bool line_overflow;
+
+    // Current measurement window
+    uint16_t window_frames;
+    uint32_t window_busy_us;
+    uint32_t window_start_us;
+    uint32_t window_start_refresh;
+    FrameStats last;        // Last completed window
+    bool have_last;
+    AckStats acks[2];       // [0] decided on arrival, [1] prepared in idle time
+
+    // Change waiting for its first full window to be reported
+    int8_t report_param;    // Index into params, -1 = none
+    int32_t report_old_value;
+    FrameStats report_before;
+
+    uint32_t (*refresh_count)();
+
+    void execute();
+    const ConsoleParam* find(const char* name, int8_t* index);
+    void printParam(const ConsoleParam& p);
+    void printStats(const FrameStats& s);
+    void printAcks(const char* label, const AckStats& a);
+    void restartWindow();
+
+public:
+    Console();
+
+    // Register a parameter; returns false when the table is full
+    bool addParam(const char* name, int32_t min_value, int32_t max_value,
+                  int32_t (*get)(), void (*set)(int32_t value));
+
+    // Source of the panel refresh counter (optional)
+    void setRefreshCounter(uint32_t (*counter)()) { refresh_count = counter; }
+
+    // Feed one received character of a ':' line (the ':' itself included).
+    // Executes the command on end of line; never blocks.
+    void feed(char c);
+
+    // Once per rendered frame with the time spent in update + render
+    void onFrame(uint32_t busy_us);
+
+    // Once per acknowledged move; prepared = the game had the result ready
+    void onMoveAck(uint32_t latency_us, bool prepared);
+};
+
+#endif // CONSOLE_H
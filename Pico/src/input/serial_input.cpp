@@ -3,19 +3,28 @@
 
 SerialInput::SerialInput() {
     reset_requested = false;
+    capture_requested = false;
+    stream_toggle_requested = false;
+    console = nullptr;
+    console_line = false;
     // mode_toggle_requested = false;
 }
 
 Direction SerialInput::getCommand() {
-    if (!Serial.available()) {
-        return DIR_NONE;
-    }
-
-    char cmd = toupper(Serial.read());
-
-    // Flush remaining buffer to avoid queuing commands
+    char cmd = 0;
     while (Serial.available()) {
-        Serial.read();
+        char c = Serial.read();
+        if (console_line) {
+            // Console lines are consumed whole, however they are split up
+            console->feed(c);
+            if (c == '\r' || c == '\n') console_line = false;
+        } else if (c == ':' && console != nullptr) {
+            console_line = true;
+            console->feed(c);
+        } else if (cmd == 0 && !isspace(c)) {
+            cmd = toupper(c);
+        }
+        // Keys after the first are dropped to avoid queuing commands
     }
 
     // Parse command - UHJK controls (U=up, H=left, J=down, K=right)
@@ -31,6 +40,12 @@ Direction SerialInput::getCommand() {
         case 'R':
             reset_requested = true;
             return DIR_NONE;
+        case 'C':
+            capture_requested = true;
+            return DIR_NONE;
+        case 'X':
+            stream_toggle_requested = true;
+            return DIR_NONE;
 
         default:
             return DIR_NONE;
@@ -44,3 +59,19 @@ bool SerialInput::isResetRequested() {
     }
     return false;
 }
+
+bool SerialInput::isCaptureRequested() {
+    if (capture_requested) {
+        capture_requested = false;
+        return true;
+    }
+    return false;
+}
+
+bool SerialInput::isStreamToggleRequested() {
+    if (stream_toggle_requested) {
+        stream_toggle_requested = false;
+        return true;
+    }
+    return false;
+}
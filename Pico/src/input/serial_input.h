@@ -5,15 +5,23 @@
 
 #include <Arduino.h>
 #include "../game/maze_generator.h"
+#include "console.h"
 
 class SerialInput {
 private:
     bool reset_requested;
+    bool capture_requested;
+    bool stream_toggle_requested;
+    Console* console;          // Receives ':' lines, nullptr = keys only
+    bool console_line;         // Inside a ':' line
 
 public:
     SerialInput();
+    void attachConsole(Console* c) { console = c; }
     Direction getCommand();
     bool isResetRequested();
+    bool isCaptureRequested();
+    bool isStreamToggleRequested();
 };
 
 #endif // SERIAL_INPUT_H
\ No newline at end of file
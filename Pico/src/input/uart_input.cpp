@@ -1,8 +1,6 @@
 // uart_input.cpp - Binary packet input handler for R4 joystick controller
 #include "uart_input.h"
-
-// Debounce time between direction changes (ms)
-static const unsigned long DIRECTION_DEBOUNCE_MS = 150;
+#include "../serial_log.h"
 
 // Debug levels: 0 = off, 1 = important events only, 2 = verbose (every packet)
 #define UART_DEBUG_LEVEL 1
@@ -15,6 +13,7 @@ UARTInput::UARTInput()
     , d9_held(false)
     , last_direction(DIR_NONE)
     , last_direction_time(0)
+    , debounce_ms(DIRECTION_DEBOUNCE_MS)
 {
 }
 
@@ -26,7 +25,7 @@ void UARTInput::init() {
     Serial1.begin(UART_BAUD);
 
 #if UART_DEBUG_LEVEL >= 1
-    Serial.println("[UART] Init: GP16/GP17, 115200 baud");
+    Log.println("[UART] Init: GP16/GP17, 115200 baud");
 #endif
 }
 
@@ -79,35 +78,35 @@ Direction UARTInput::getCommand() {
         if (packet_idx == 0) {
             if (byte == 'R') {
 #if UART_DEBUG_LEVEL >= 1
-                Serial.println("[UART] Reset command");
+                Log.println("[UART] Reset command");
 #endif
                 reset_requested = true;
                 continue;
             }
             if (byte == 'o') {
 #if UART_DEBUG_LEVEL >= 1
-                Serial.println("[UART] Win command");
+                Log.println("[UART] Win command");
 #endif
                 win_requested = true;
                 continue;
             }
             if (byte == 's') {
 #if UART_DEBUG_LEVEL >= 1
-                Serial.println("[UART] Start command");
+                Log.println("[UART] Start command");
 #endif
                 start_requested = true;
                 continue;
             }
             if (byte == 'H') {
 #if UART_DEBUG_LEVEL >= 1
-                Serial.println("[UART] D9 Held");
+                Log.println("[UART] D9 Held");
 #endif
                 d9_held = true;
                 continue;
             }
             if (byte == 'U') {
 #if UART_DEBUG_LEVEL >= 1
-                Serial.println("[UART] D9 Unheld");
+                Log.println("[UART] D9 Unheld");
 #endif
                 d9_held = false;
                 continue;
@@ -146,7 +145,7 @@ Direction UARTInput::getCommand() {
                     // Debouncing: only output a direction if it's new
                     // OR enough time has passed holding that direction
                     if (dir != DIR_NONE) {
-                        if (dir != last_direction || (now - last_direction_time >= DIRECTION_DEBOUNCE_MS)) {
+                        if (dir != last_direction || (now - last_direction_time >= debounce_ms)) {
                             result = dir;
                             last_direction = dir;
                             last_direction_time = now;
@@ -155,8 +154,8 @@ Direction UARTInput::getCommand() {
                             const char* dirName = (dir == NORTH) ? "N" :
                                                   (dir == SOUTH) ? "S" :
                                                   (dir == EAST) ? "E" : "W";
-                            Serial.print("[UART] Dir: ");
-                            Serial.println(dirName);
+                            Log.print("[UART] Dir: ");
+                            Log.println(dirName);
 #endif
                         }
                     } else {
@@ -166,7 +165,7 @@ Direction UARTInput::getCommand() {
                 }
 #if UART_DEBUG_LEVEL >= 2
                 else {
-                    Serial.println("[UART] Bad checksum");
+                    Log.println("[UART] Bad checksum");
                 }
 #endif
 
@@ -23,6 +23,7 @@ private:
     // Direction debouncing
     Direction last_direction;
     unsigned long last_direction_time;
+    unsigned long debounce_ms;
 
     // Main button state tracking (for short/long press via 'R'/'T' chars)
     // Note: The R4 sends 'R' or 'T' separately for button events
@@ -39,6 +40,10 @@ public:
     bool isWinRequested();
     bool isStartRequested();
     bool isD9Held() const { return d9_held; }
+
+    // Repeat interval for the same direction (run-time tunable)
+    void setDebounceMs(unsigned long ms) { debounce_ms = ms; }
+    unsigned long getDebounceMs() const { return debounce_ms; }
 };
 
 #endif // UART_INPUT_H
@@ -3,15 +3,63 @@
 #include <Arduino.h>
 #include "config.h"
 #include "display/display_manager.h"
+#include "display/frame_capture.h"
 #include "game/game_state.h"
 #include "input/serial_input.h"
 #include "input/uart_input.h"
+#include "input/console.h"
+#include "serial_log.h"
 
 // Game objects
 DisplayManager display;
 GameState game;
 SerialInput serial_input;
 UARTInput uart_input;
+FrameCapture frame_capture;
+Console console;
+
+// Frame pacing: deadline of the next rendered frame (micros)
+uint32_t next_frame_us = 0;
+uint32_t frame_interval_us = FRAME_INTERVAL_US;  // Tunable from the console
+
+// Parameters the USB serial console can read and change at run time
+void registerConsoleParams() {
+    console.addParam("brightness", 0, 255,
+        [] { return (int32_t)display.getBrightness(); },
+        [](int32_t v) { display.setBrightness(v); });
+    console.addParam("bitplanes", 4, 8,
+        [] { return (int32_t)display.getBitPlanes(); },
+        [](int32_t v) { display.setBitPlanes(v); });
+    console.addParam("frame_us", 8333, 100000,
+        [] { return (int32_t)frame_interval_us; },
+        [](int32_t v) {
+            frame_interval_us = v;
+            SpriteRenderer::setFrameInterval(v);
+        });
+    console.addParam("debounce_ms", 0, 1000,
+        [] { return (int32_t)uart_input.getDebounceMs(); },
+        [](int32_t v) { uart_input.setDebounceMs(v); });
+    console.addParam("maze_min_exits", 1, 4,
+        [] { return (int32_t)game.getMaze().getMinExits(); },
+        [](int32_t v) { game.getMaze().setExitRange(v, game.getMaze().getMaxExits()); });
+    console.addParam("maze_max_exits", 1, 4,
+        [] { return (int32_t)game.getMaze().getMaxExits(); },
+        [](int32_t v) { game.getMaze().setExitRange(game.getMaze().getMinExits(), v); });
+    console.addParam("maze_persist", 0, 1,
+        [] { return (int32_t)game.getMaze().isPersistent(); },
+        [](int32_t v) { game.setMazePersistent(v); });
+    console.addParam("maze_algo", 0, MAZE_ALGO_COUNT - 1,
+        [] { return (int32_t)game.getMaze().getAlgorithm(); },
+        [](int32_t v) { game.setMazeAlgorithm(v); });
+    console.addParam("hazard_ms", 100, 10000,
+        [] { return (int32_t)game.getEntities().getStepMs(); },
+        [](int32_t v) { game.getEntities().setStepMs(v); });
+    console.addParam("speculate", 0, 1,
+        [] { return (int32_t)game.isSpeculating(); },
+        [](int32_t v) { game.setSpeculation(v); });
+    console.setRefreshCounter([] { return display.getRefreshCount(); });
+    serial_input.attachConsole(&console);
+}
 
 void setup() {
     // Initialize serial communication
@@ -47,6 +95,7 @@ void setup() {
     // Initialize game
     Serial.println("Initializing game state...");
     game.init();
+    registerConsoleParams();
 
     Serial.println();
     Serial.println("========================================");
@@ -58,8 +107,12 @@ void setup() {
     Serial.println("  --- USB Serial Backup ---");
     Serial.println("  U/H/J/K = Move, R = Reset");
     Serial.println("  (U=Up, H=Left, J=Down, K=Right)");
+    Serial.println("  C = Capture frame, X = Toggle frame stream");
+    Serial.println("  :list / :get NAME / :set NAME VALUE / :stats = Tuning console");
     Serial.println("========================================");
     Serial.println();
+
+    next_frame_us = micros();
 }
 
 void loop() {
@@ -71,33 +124,50 @@ void loop() {
     Direction dir = (uart_dir != DIR_NONE) ? uart_dir : serial_dir;
 
     if (dir != DIR_NONE) {
-        // Debug: Print received direction
-        static const char* dirNames[] = {"N", "E", "S", "W"};
-        Serial.print("[INPUT] Direction: ");
-        Serial.println(dirNames[dir]);
-
+        uint32_t input_us = micros();
         game.handleInput(dir);
 
-        // Send response to R4 controller
+        // Ack before anything else: logging and the move's aftermath come after
         MoveResult res = game.getLastMoveResult();
         if (res == MOVE_VALID) {
             Serial1.write('V');
-            Serial.println("[RESPONSE] V (valid move)");
         } else if (res == MOVE_INVALID) {
             Serial1.write('I');
-            Serial.println("[RESPONSE] I (blocked)");
         } else if (res == MOVE_GOAL) {
             Serial1.write('G');
-            Serial.println("[RESPONSE] G (goal reached!)");
+        }
+        if (res != MOVE_NONE) console.onMoveAck(micros() - input_us, game.wasMovePrepared());
+        game.finishMove();
+
+        static const char* dirNames[] = {"N", "E", "S", "W"};
+        Log.print("[INPUT] Direction: ");
+        Log.println(dirNames[dir]);
+        if (res == MOVE_VALID) {
+            Log.println("[RESPONSE] V (valid move)");
+        } else if (res == MOVE_INVALID) {
+            Log.println("[RESPONSE] I (blocked)");
+        } else if (res == MOVE_GOAL) {
+            Log.println("[RESPONSE] G (goal reached!)");
         }
     }
 
     // Check for reset request from either source
     if (serial_input.isResetRequested() || uart_input.isResetRequested()) {
-        Serial.println("[GAME] Reset");
+        Log.println("[GAME] Reset");
         game.init();
     }
 
+    // Framebuffer capture requests (USB serial only)
+    if (serial_input.isCaptureRequested()) {
+        frame_capture.requestCapture();
+    }
+    if (serial_input.isStreamToggleRequested()) {
+        frame_capture.toggleStream();
+    }
+
+    // Drain any capture in flight, a USB-buffer-sized chunk at a time
+    frame_capture.service();
+
     // Check for win trigger (power switch flipped)
     if (uart_input.isWinRequested()) {
         game.triggerWin();
@@ -105,19 +175,36 @@ void loop() {
 
     // Check for start signal (ENTER button on R4)
     if (uart_input.isStartRequested()) {
-        Serial.println("[GAME] Start signal received");
+        Log.println("[GAME] Start signal received");
         // Start signal triggers game init from start screen
         if (game.isStartScreen()) {
             game.handleInput(NORTH);  // Any direction triggers start
         }
     }
 
+    // Input and acks above run on every pass; rendering only on frame deadlines,
+    // so a move is acknowledged at once and the sprite tween shows it afterwards
+    uint32_t now_us = micros();
+    if ((int32_t)(now_us - next_frame_us) < 0) {
+        return;
+    }
+
+    next_frame_us += frame_interval_us;
+    if ((int32_t)(now_us - next_frame_us) >= 0) {
+        // Fell more than a frame behind: drop the backlog instead of bursting
+        next_frame_us = now_us + frame_interval_us;
+    }
+
     // Update game logic
     game.update();
 
     // Render to display (pass D9 held state for status bar)
     game.render(&display, uart_input.isD9Held());
-    
-    // Game loop timing (~60 FPS)
-    delay(16);
+    console.onFrame(micros() - now_us);
+
+    // Snapshot the finished frame if a capture/stream frame is due
+    frame_capture.onFrameRendered(&display);
+
+    // Rest of the frame is idle: have the next move's outcome ready
+    game.prepareMoves();
 }
@@ -0,0 +1,56 @@
+// serial_log.h
+// Log output on USB serial that never lands inside a frame capture packet.
+// FrameCapture writes a packet over several loop passes; while one is in
+// flight, log text is held here and written out once the packet is complete
+// (text past LOG_HOLD_BYTES is dropped and counted). Outside of transfers it
+// goes straight to Serial. Header-only so modules that log don't need
+// another source file in their build.
+#ifndef SERIAL_LOG_H
+#define SERIAL_LOG_H
+
+#include <Arduino.h>
+#include "config.h"
+
+class SerialLog : public Print {
+private:
+    uint8_t held[LOG_HOLD_BYTES];
+    uint16_t held_len = 0;
+    uint16_t dropped = 0;
+    bool holding = false;
+
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+
+    size_t write(const uint8_t* buf, size_t len) override {
+        if (!holding) return Serial.write(buf, len);
+        for (size_t i = 0; i < len; i++) {
+            if (held_len < LOG_HOLD_BYTES) {
+                held[held_len++] = buf[i];
+            } else if (dropped < 0xFFFF) {
+                dropped++;
+            }
+        }
+        return len;
+    }
+    using Print::write;
+
+    // FrameCapture: a packet is going out, keep log text off the wire
+    void hold() { holding = true; }
+
+    // FrameCapture: packet complete, write out what was held
+    void release() {
+        holding = false;
+        if (held_len > 0) Serial.write(held, held_len);
+        if (dropped > 0) {
+            Serial.print("[LOG] ");
+            Serial.print((int)dropped);
+            Serial.println(" bytes dropped during frame transfer");
+        }
+        held_len = 0;
+        dropped = 0;
+    }
+};
+
+inline SerialLog Log;
+
+#endif // SERIAL_LOG_H
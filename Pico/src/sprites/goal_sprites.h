@@ -1,92 +1,120 @@
 // sprites/goal_sprites.h
-// Goal sprite pixel data - RGB565 format
-// Animated doorway that changes color based on distance
+// Packed indexed sprite data (see SpriteFrame in sprite.h for the layout)
+// GENERATED by tools/sprite_pipeline.py from assets/sprites/goal.sprite - do not edit
 #ifndef GOAL_SPRITES_H
 #define GOAL_SPRITES_H
 
 #include <Arduino.h>
+#include "../config.h"
 #include "sprite.h"
 
-// Color palette (will be replaced at runtime with distance-based colors)
-#define GD   0xFFFF 
-#define GI   0x2104 
-#define _T_  TRANSPARENT_COLOR  // Transparent
+// =============================================================================
+// GOAL: 8x8, 2 bpp, 3 frame(s) in 1 clip(s), 73 bytes packed (384 as RGB565)
+// Compiled (tint): ~402 bytes of code (estimated, not measured), run from RAM
+// =============================================================================
 
-// Goal - Frame 0 (Door base)
-const uint16_t PROGMEM GOAL_F0[] = {
-    // Row 0 - Arch top
-    _T_, _T_, GD,  GD,  GD,  GD,  _T_, _T_,
-    // Row 1 - Arch sides
-    _T_, GD,  GD,  GD,  GD,  GD,  GD,  _T_,
-    // Row 2 - Door frame + interior
-    GD,  GD,  GI,  GI,  GI,  GI,  GD,  GD,
-    // Row 3 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 4 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 5 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 6 - Bottom frame
-    GD,  GD,  GI,  GI,  GI,  GI,  GD,  GD,
-    // Row 7 - Base
-    GD,  GD,  GD,  GD,  GD,  GD,  GD,  GD,
+const uint8_t PROGMEM GOAL_PALETTE_MAP[] = { 0, 1, 0, 0 };
+
+// Frame 0 - Door base
+const uint8_t PROGMEM GOAL_F0_MASK[] = {
+    0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+const uint8_t PROGMEM GOAL_F0_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x55, 0x40, 0x55, 0x41, 0x55, 0x41, 0x55, 0x01, 0x55,
+    0x00, 0x00, 0x00,
 };
 
-// Goal - Frame 1 (Interior slightly brighter - subtle pulse)
-const uint16_t PROGMEM GOAL_F1[] = {
-    // Row 0 - Arch top
-    _T_, _T_, GD,  GD,  GD,  GD,  _T_, _T_,
-    // Row 1 - Arch sides
-    _T_, GD,  GI,  GI,  GI,  GI,  GD,  _T_,
-    // Row 2 - Door frame + interior (opens slightly)
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 3 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 4 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 5 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 6 - Bottom frame
-    GD,  GD,  GI,  GI,  GI,  GI,  GD,  GD,
-    // Row 7 - Base
-    GD,  GD,  GD,  GD,  GD,  GD,  GD,  GD,
+static void __not_in_flash_func(GOAL_F0_FILL)(uint32_t* dst, uint32_t color) {
+    dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color;
+    dst += MATRIX_WIDTH;
+    dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+}
+
+// Frame 1 - Interior opens
+const uint8_t PROGMEM GOAL_F1_MASK[] = {
+    0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+const uint8_t PROGMEM GOAL_F1_PIXELS[] = {
+    0x00, 0x54, 0x41, 0x55, 0x41, 0x55, 0x41, 0x55, 0x41, 0x55, 0x01, 0x55,
+    0x00, 0x00, 0x00,
 };
 
-// Goal - Frame 2 (Interior brightest)
-const uint16_t PROGMEM GOAL_F2[] = {
-    // Row 0 - Arch top
-    _T_, _T_, GD,  GD,  GD,  GD,  _T_, _T_,
-    // Row 1 - Arch sides (more open)
-    _T_, GD,  GI,  GI,  GI,  GI,  GD,  _T_,
-    // Row 2 - Door frame + interior (more open)
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 3 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 4 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 5 - Interior
-    GD,  GI,  GI,  GI,  GI,  GI,  GI,  GD,
-    // Row 6 - Bottom frame
-    GD,  GD,  GI,  GI,  GI,  GI,  GD,  GD,
-    // Row 7 - Base
-    GD,  GD,  GD,  GD,  GD,  GD,  GD,  GD,
+static void __not_in_flash_func(GOAL_F1_FILL)(uint32_t* dst, uint32_t color) {
+    dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color;
+    dst += MATRIX_WIDTH;
+    dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+}
+
+// Frame 2 - Interior fully open
+const uint8_t PROGMEM GOAL_F2_MASK[] = {
+    0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+const uint8_t PROGMEM GOAL_F2_PIXELS[] = {
+    0x00, 0x54, 0x41, 0x55, 0x41, 0x55, 0x41, 0x55, 0x41, 0x55, 0x01, 0x55,
+    0x00, 0x00, 0x00,
 };
 
-// Frame pointer array for goal animation
-const uint16_t* const PROGMEM GOAL_FRAMES[] = {
-    GOAL_F0,
-    GOAL_F1,
-    GOAL_F2
+static void __not_in_flash_func(GOAL_F2_FILL)(uint32_t* dst, uint32_t color) {
+    dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color;
+    dst += MATRIX_WIDTH;
+    dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+    dst += MATRIX_WIDTH;
+    dst[0] = color; dst[1] = color; dst[2] = color; dst[3] = color; dst[4] = color; dst[5] = color; dst[6] = color; dst[7] = color;
+}
+
+const SpriteFrame PROGMEM GOAL_IDLE_FRAMES[] = {
+    { GOAL_F0_MASK, GOAL_F0_PIXELS, nullptr, GOAL_F0_FILL },
+    { GOAL_F1_MASK, GOAL_F1_PIXELS, nullptr, GOAL_F1_FILL },
+    { GOAL_F2_MASK, GOAL_F2_PIXELS, nullptr, GOAL_F2_FILL },
 };
 
-// Goal sprite definition
 const SpriteDefinition GOAL_SPRITE PROGMEM = {
     .width = 8,
     .height = 8,
-    .idle = {
-        .frames = GOAL_FRAMES,
-        .frame_count = 3,
-        .frame_duration_ms = 300  // Slower pulse (0.9s cycle)
+    .bpp = 2,
+    .palette_map = GOAL_PALETTE_MAP,
+    .clips = {
+        { GOAL_IDLE_FRAMES, 3, 300, ANIM_LOOP },  // idle
+        { nullptr, 0, 0, 0 },  // walk_n (none)
+        { nullptr, 0, 0, 0 },  // walk_e (none)
+        { nullptr, 0, 0, 0 },  // walk_s (none)
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { nullptr, 0, 0, 0 },  // bump (none)
+        { nullptr, 0, 0, 0 },  // celebrate (none)
     }
 };
 
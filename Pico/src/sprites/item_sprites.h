@@ -0,0 +1,245 @@
+// sprites/item_sprites.h
+// Packed indexed sprite data (see SpriteFrame in sprite.h for the layout)
+// GENERATED by tools/sprite_pipeline.py from assets/sprites/hazard.sprite, assets/sprites/key.sprite, assets/sprites/trap.sprite - do not edit
+#ifndef ITEM_SPRITES_H
+#define ITEM_SPRITES_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "sprite.h"
+
+// =============================================================================
+// HAZARD: 8x8, 2 bpp, 2 frame(s) in 1 clip(s), 43 bytes packed (256 as RGB565)
+// Compiled (draw): ~256 bytes of code (estimated, not measured), run from RAM
+// =============================================================================
+
+const uint8_t PROGMEM HAZARD_PALETTE_MAP[] = { 2, 0, 3, 0 };
+
+// Frame 0 - Spikes out
+const uint8_t PROGMEM HAZARD_F0_MASK[] = {
+    0x99, 0x7E, 0x7E, 0xFF, 0xFF, 0x7E, 0x7E, 0x99,
+};
+const uint8_t PROGMEM HAZARD_F0_PIXELS[] = {
+    0x00, 0x00, 0x40, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(HAZARD_F0_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF01000;  // FA00
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[0] = c0; dst[3] = c0; dst[4] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c1; dst[3] = c2; dst[4] = c2; dst[5] = c1; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[3] = c0; dst[4] = c0; dst[7] = c0;
+}
+
+// Frame 1 - Spikes in
+const uint8_t PROGMEM HAZARD_F1_MASK[] = {
+    0x18, 0x7E, 0x7E, 0xFF, 0xFF, 0x7E, 0x7E, 0x18,
+};
+const uint8_t PROGMEM HAZARD_F1_PIXELS[] = {
+    0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(HAZARD_F1_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF01000;  // FA00
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c1; dst[3] = c2; dst[4] = c2; dst[5] = c1; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0; dst[4] = c0;
+}
+
+const SpriteFrame PROGMEM HAZARD_IDLE_FRAMES[] = {
+    { HAZARD_F0_MASK, HAZARD_F0_PIXELS, HAZARD_F0_DRAW, nullptr },
+    { HAZARD_F1_MASK, HAZARD_F1_PIXELS, HAZARD_F1_DRAW, nullptr },
+};
+
+const SpriteDefinition HAZARD_SPRITE PROGMEM = {
+    .width = 8,
+    .height = 8,
+    .bpp = 2,
+    .palette_map = HAZARD_PALETTE_MAP,
+    .clips = {
+        { HAZARD_IDLE_FRAMES, 2, 180, ANIM_LOOP },  // idle
+        { nullptr, 0, 0, 0 },  // walk_n (none)
+        { nullptr, 0, 0, 0 },  // walk_e (none)
+        { nullptr, 0, 0, 0 },  // walk_s (none)
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { nullptr, 0, 0, 0 },  // bump (none)
+        { nullptr, 0, 0, 0 },  // celebrate (none)
+    }
+};
+
+// =============================================================================
+// KEY: 8x8, 2 bpp, 2 frame(s) in 1 clip(s), 28 bytes packed (256 as RGB565)
+// Compiled (draw): ~114 bytes of code (estimated, not measured), run from RAM
+// =============================================================================
+
+const uint8_t PROGMEM KEY_PALETTE_MAP[] = { 4, 5, 0, 0 };
+
+// Frame 0 - Bow up
+const uint8_t PROGMEM KEY_F0_MASK[] = {
+    0x00, 0x38, 0x28, 0x38, 0x10, 0x18, 0x10, 0x18,
+};
+const uint8_t PROGMEM KEY_F0_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x04,
+};
+
+static void __not_in_flash_func(KEY_F0_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF0F800;  // FFE0
+    const uint32_t c1 = 0x902400;  // C300
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0; dst[4] = c1;
+}
+
+// Frame 1 - Glint
+const uint8_t PROGMEM KEY_F1_MASK[] = {
+    0x00, 0x38, 0x2A, 0x38, 0x10, 0x18, 0x10, 0x18,
+};
+const uint8_t PROGMEM KEY_F1_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x10,
+};
+
+static void __not_in_flash_func(KEY_F1_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF0F800;  // FFE0
+    const uint32_t c1 = 0x902400;  // C300
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[4] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0; dst[4] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0;
+    dst += MATRIX_WIDTH;
+    dst[3] = c0; dst[4] = c1;
+}
+
+const SpriteFrame PROGMEM KEY_IDLE_FRAMES[] = {
+    { KEY_F0_MASK, KEY_F0_PIXELS, KEY_F0_DRAW, nullptr },
+    { KEY_F1_MASK, KEY_F1_PIXELS, KEY_F1_DRAW, nullptr },
+};
+
+const SpriteDefinition KEY_SPRITE PROGMEM = {
+    .width = 8,
+    .height = 8,
+    .bpp = 2,
+    .palette_map = KEY_PALETTE_MAP,
+    .clips = {
+        { KEY_IDLE_FRAMES, 2, 250, ANIM_LOOP },  // idle
+        { nullptr, 0, 0, 0 },  // walk_n (none)
+        { nullptr, 0, 0, 0 },  // walk_e (none)
+        { nullptr, 0, 0, 0 },  // walk_s (none)
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { nullptr, 0, 0, 0 },  // bump (none)
+        { nullptr, 0, 0, 0 },  // celebrate (none)
+    }
+};
+
+// =============================================================================
+// TRAP: 8x8, 2 bpp, 2 frame(s) in 1 clip(s), 27 bytes packed (256 as RGB565)
+// Compiled (draw): ~92 bytes of code (estimated, not measured), run from RAM
+// =============================================================================
+
+const uint8_t PROGMEM TRAP_PALETTE_MAP[] = { 8, 9, 0, 0 };
+
+// Frame 0 - Spikes down
+const uint8_t PROGMEM TRAP_F0_MASK[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xFE, 0x00,
+};
+const uint8_t PROGMEM TRAP_F0_PIXELS[] = {
+    0x40, 0x55, 0x05,
+};
+
+static void __not_in_flash_func(TRAP_F0_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x404040;  // 8410
+    const uint32_t c1 = 0x101010;  // 4208
+    dst += 5 * MATRIX_WIDTH;
+    dst[1] = c0; dst[3] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c1; dst[1] = c1; dst[2] = c1; dst[3] = c1; dst[4] = c1; dst[5] = c1; dst[6] = c1;
+}
+
+// Frame 1 - Spikes up
+const uint8_t PROGMEM TRAP_F1_MASK[] = {
+    0x00, 0x00, 0x00, 0x54, 0x54, 0x54, 0xFE, 0x00,
+};
+const uint8_t PROGMEM TRAP_F1_PIXELS[] = {
+    0x00, 0x00, 0x54, 0x55,
+};
+
+static void __not_in_flash_func(TRAP_F1_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x404040;  // 8410
+    const uint32_t c1 = 0x101010;  // 4208
+    dst += 3 * MATRIX_WIDTH;
+    dst[1] = c0; dst[3] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[3] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[3] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c1; dst[1] = c1; dst[2] = c1; dst[3] = c1; dst[4] = c1; dst[5] = c1; dst[6] = c1;
+}
+
+const SpriteFrame PROGMEM TRAP_IDLE_FRAMES[] = {
+    { TRAP_F0_MASK, TRAP_F0_PIXELS, TRAP_F0_DRAW, nullptr },
+    { TRAP_F1_MASK, TRAP_F1_PIXELS, TRAP_F1_DRAW, nullptr },
+};
+
+const SpriteDefinition TRAP_SPRITE PROGMEM = {
+    .width = 8,
+    .height = 8,
+    .bpp = 2,
+    .palette_map = TRAP_PALETTE_MAP,
+    .clips = {
+        { TRAP_IDLE_FRAMES, 2, 400, ANIM_LOOP },  // idle
+        { nullptr, 0, 0, 0 },  // walk_n (none)
+        { nullptr, 0, 0, 0 },  // walk_e (none)
+        { nullptr, 0, 0, 0 },  // walk_s (none)
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { nullptr, 0, 0, 0 },  // bump (none)
+        { nullptr, 0, 0, 0 },  // celebrate (none)
+    }
+};
+
+#endif // ITEM_SPRITES_H
@@ -1,155 +1,848 @@
 // sprites/player_sprites.h
-// Player sprite pixel data - RGB565 format
-// Each sprite is 8x8 pixels = 64 uint16_t values per frame
-// Layout: Row-major order (left to right, top to bottom)
+// Packed indexed sprite data (see SpriteFrame in sprite.h for the layout)
+// GENERATED by tools/sprite_pipeline.py from assets/sprites/player1.sprite, assets/sprites/player2.sprite - do not edit
 #ifndef PLAYER_SPRITES_H
 #define PLAYER_SPRITES_H
 
 #include <Arduino.h>
+#include "../config.h"
 #include "sprite.h"
 
 // =============================================================================
-// GLOBAL COLORS
+// PLAYER1: 8x8, 2 bpp, 13 frame(s) in 6 clip(s), 239 bytes packed (1664 as RGB565)
+// Compiled (draw): ~1432 bytes of code (estimated, not measured), run from RAM
 // =============================================================================
-#define WH   0xFFFF  // White - Eye
-#define BK   0x0000  // Black - Eye pupil
-#define _T_  TRANSPARENT_COLOR  // Transparent
 
-// =============================================================================
-// PLAYER 1 SPRITE (Red theme)
-// =============================================================================
+const uint8_t PROGMEM PLAYER1_PALETTE_MAP[] = { 6, 0, 3, 0 };
 
-// Color palette
-#define B1   0x5F0B  // Body - Green (matching PLAYER1_COLOR)
-#define D1   0x7005  // Dark - shadow/outline
-#define L1   0xF80E  // Light - highlight
-#define S1   0xFE73  // Skin - head (Unused in new design)
-
-// Player 1 - Frame 0 (Left Arm Down, Right Arm Up)
-const uint16_t PROGMEM P1_IDLE_F0[] = {
-    // Row 0 
-    _T_, _T_, B1,  B1,  B1,  B1,  _T_, _T_,
-    // Row 1
-    _T_, B1, B1,  WH,  BK,  B1,  B1, _T_,
-    // Row 2
-    _T_, B1,  B1,  BK,  BK,  B1,  B1,  _T_,
-    // Row 3
-    _T_,  _T_,  B1,  B1,  B1,  B1,  _T_,  B1,
-    // Row 4
-    B1,  B1,  B1,  B1,  B1,  B1,  B1,  B1,
-    // Row 5
-    B1, _T_,  B1,  B1,  B1,  B1,  _T_,  _T_,
-    // Row 6
-    _T_, _T_, B1,  _T_, _T_, B1,  B1,  _T_,
-    // Row 7
-    _T_, B1,  B1,  _T_, _T_, _T_, _T_, _T_,
-};
-
-// Player 1 - Frame 1 (Right Arm Down, Left Arm Up)
-const uint16_t PROGMEM P1_IDLE_F1[] = {
-    // Row 0 
-    _T_, _T_, B1,  B1,  B1,  B1,  _T_, _T_,
-    // Row 1
-    _T_, B1, B1,  BK,  WH,  B1,  B1, _T_,
-    // Row 2
-    _T_, B1,  B1,  BK,  BK,  B1,  B1,  _T_,
-    // Row 3
-    B1,  _T_, B1,  B1,  B1,  B1,  _T_, _T_,
-    // Row 4
-    B1,  B1,  B1,  B1,  B1,  B1,  B1,  B1,
-    // Row 5
-    _T_, _T_, B1,  B1,  B1,  B1,  _T_, B1,
-    // Row 6
-    _T_, B1,  B1,  _T_, _T_, B1,  _T_, _T_,
-    // Row 7
-    _T_, _T_, _T_, _T_, _T_, B1,  B1,  _T_,
-};
-
-// Frame pointer array for Player 1 idle animation
-const uint16_t* const PROGMEM P1_IDLE_FRAMES[] = {
-    P1_IDLE_F0,
-    P1_IDLE_F1
+// Frame 0 - Left arm down, right arm up
+const uint8_t PROGMEM PLAYER1_F0_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER1_F0_PIXELS[] = {
+    0x00, 0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-// =============================================================================
-// PLAYER 2 SPRITE (Cyan theme)
-// =============================================================================
+static void __not_in_flash_func(PLAYER1_F0_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
 
-// Color palette for Player 2
-#define B2   0xF800  // Body - Red (matching PLAYER2_COLOR)
-#define D2   0x0410  // Dark - shadow/outline
-#define L2   0x7FFF  // Light - highlight
-#define S2   0xFE73  // Skin - head (Unused)
-
-// Player 2 - Frame 0 (Same shape as P1 F0)
-const uint16_t PROGMEM P2_IDLE_F0[] = {
-    // Row 0
-    _T_, _T_, B2,  B2,  B2,  B2,  _T_, _T_,
-    // Row 1
-    _T_, B2, B2,  WH,  BK,  B2,  B2, _T_,
-    // Row 2
-    _T_, B2,  B2,  BK,  BK,  B2,  B2,  _T_,
-    // Row 3
-    _T_,  _T_,  B2,  B2,  B2,  B2,  _T_,  B2,
-    // Row 4
-    B2,  B2,  B2,  B2,  B2,  B2,  B2,  B2,
-    // Row 5
-    B2, _T_,  B2,  B2,  B2,  B2,  _T_,  _T_,
-    // Row 6
-    _T_, _T_, B2,  _T_, _T_, B2,  B2,  _T_,
-    // Row 7
-    _T_, B2,  B2,  _T_, _T_, _T_, _T_, _T_,
-};
-
-// Player 2 - Frame 1 (Same shape as P1 F1)
-const uint16_t PROGMEM P2_IDLE_F1[] = {
-    // Row 0
-    _T_, _T_, B2,  B2,  B2,  B2,  _T_, _T_,
-    // Row 1 - Mirrored
-    _T_, B2, B2,  BK,  WH,  B2,  B2, _T_,
-    // Row 2 - Mirrored (same)
-    _T_, B2,  B2,  BK,  BK,  B2,  B2,  _T_,
-    // Row 3 - Mirrored
-    B2,  _T_, B2,  B2,  B2,  B2,  _T_, _T_,
-    // Row 4 - Mirrored (same)
-    B2,  B2,  B2,  B2,  B2,  B2,  B2,  B2,
-    // Row 5 - Mirrored
-    _T_, _T_, B2,  B2,  B2,  B2,  _T_, B2,
-    // Row 6 - Mirrored
-    _T_, B2,  B2,  _T_, _T_, B2,  _T_, _T_,
-    // Row 7 - Mirrored
-    _T_, _T_, _T_, _T_, _T_, B2,  B2,  _T_,
-};
-
-// Frame pointer array for Player 2 idle animation
-const uint16_t* const PROGMEM P2_IDLE_FRAMES[] = {
-    P2_IDLE_F0,
-    P2_IDLE_F1
+// Frame 1 - Right arm down, left arm up
+const uint8_t PROGMEM PLAYER1_F1_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER1_F1_PIXELS[] = {
+    0x00, 0x60, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-// =============================================================================
-// SPRITE DEFINITIONS (Combine frames into complete definitions)
-// =============================================================================
+static void __not_in_flash_func(PLAYER1_F1_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 2 - Back view, left leg up
+const uint8_t PROGMEM PLAYER1_F2_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER1_F2_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F2_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
+
+// Frame 3 - Back view, right leg up
+const uint8_t PROGMEM PLAYER1_F3_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER1_F3_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F3_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 4 - Leaning right, back leg out
+const uint8_t PROGMEM PLAYER1_F4_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3C, 0x7F, 0xBC, 0x24, 0x63,
+};
+const uint8_t PROGMEM PLAYER1_F4_PIXELS[] = {
+    0x00, 0x40, 0x02, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F4_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c1; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c2; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[6] = c0; dst[7] = c0;
+}
+
+// Frame 5 - Legs together
+const uint8_t PROGMEM PLAYER1_F5_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3C, 0xFE, 0x3D, 0x3C, 0x24,
+};
+const uint8_t PROGMEM PLAYER1_F5_PIXELS[] = {
+    0x00, 0x40, 0x02, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F5_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c1; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c2; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+}
+
+// Frame 6 - Looking down, left leg up
+const uint8_t PROGMEM PLAYER1_F6_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER1_F6_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F6_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
+
+// Frame 7 - Looking down, right leg up
+const uint8_t PROGMEM PLAYER1_F7_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER1_F7_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F7_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 8 - Squashed against the wall
+const uint8_t PROGMEM PLAYER1_F8_MASK[] = {
+    0x00, 0x3C, 0x7E, 0x7E, 0xFF, 0xFF, 0x7E, 0x66,
+};
+const uint8_t PROGMEM PLAYER1_F8_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F8_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 9 - Flattened, eyes shut
+const uint8_t PROGMEM PLAYER1_F9_MASK[] = {
+    0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+};
+const uint8_t PROGMEM PLAYER1_F9_PIXELS[] = {
+    0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F9_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    dst += 2 * MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c1; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c1; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[6] = c0; dst[7] = c0;
+}
+
+// Frame 10 - Arms up
+const uint8_t PROGMEM PLAYER1_F10_MASK[] = {
+    0xBD, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x24, 0x66,
+};
+const uint8_t PROGMEM PLAYER1_F10_PIXELS[] = {
+    0x00, 0x00, 0x24, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F10_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 11 - Jump
+const uint8_t PROGMEM PLAYER1_F11_MASK[] = {
+    0xFF, 0x7E, 0x7E, 0x3C, 0x3C, 0x24, 0x66, 0x00,
+};
+const uint8_t PROGMEM PLAYER1_F11_PIXELS[] = {
+    0x00, 0x00, 0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F11_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 12 - Arms up, wink
+const uint8_t PROGMEM PLAYER1_F12_MASK[] = {
+    0xBD, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x24, 0x66,
+};
+const uint8_t PROGMEM PLAYER1_F12_PIXELS[] = {
+    0x00, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER1_F12_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0x1EC41E;  // 5F0B
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+const SpriteFrame PROGMEM PLAYER1_IDLE_FRAMES[] = {
+    { PLAYER1_F0_MASK, PLAYER1_F0_PIXELS, PLAYER1_F0_DRAW, nullptr },
+    { PLAYER1_F1_MASK, PLAYER1_F1_PIXELS, PLAYER1_F1_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER1_WALK_N_FRAMES[] = {
+    { PLAYER1_F2_MASK, PLAYER1_F2_PIXELS, PLAYER1_F2_DRAW, nullptr },
+    { PLAYER1_F3_MASK, PLAYER1_F3_PIXELS, PLAYER1_F3_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER1_WALK_E_FRAMES[] = {
+    { PLAYER1_F4_MASK, PLAYER1_F4_PIXELS, PLAYER1_F4_DRAW, nullptr },
+    { PLAYER1_F5_MASK, PLAYER1_F5_PIXELS, PLAYER1_F5_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER1_WALK_S_FRAMES[] = {
+    { PLAYER1_F6_MASK, PLAYER1_F6_PIXELS, PLAYER1_F6_DRAW, nullptr },
+    { PLAYER1_F7_MASK, PLAYER1_F7_PIXELS, PLAYER1_F7_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER1_BUMP_FRAMES[] = {
+    { PLAYER1_F8_MASK, PLAYER1_F8_PIXELS, PLAYER1_F8_DRAW, nullptr },
+    { PLAYER1_F9_MASK, PLAYER1_F9_PIXELS, PLAYER1_F9_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER1_CELEBRATE_FRAMES[] = {
+    { PLAYER1_F10_MASK, PLAYER1_F10_PIXELS, PLAYER1_F10_DRAW, nullptr },
+    { PLAYER1_F11_MASK, PLAYER1_F11_PIXELS, PLAYER1_F11_DRAW, nullptr },
+    { PLAYER1_F12_MASK, PLAYER1_F12_PIXELS, PLAYER1_F12_DRAW, nullptr },
+};
 
-// Player 1 complete sprite definition
 const SpriteDefinition PLAYER1_SPRITE PROGMEM = {
     .width = 8,
     .height = 8,
-    .idle = {
-        .frames = P1_IDLE_FRAMES,
-        .frame_count = 2,
-        .frame_duration_ms = 150  // Fast animation (0.3s cycle)
+    .bpp = 2,
+    .palette_map = PLAYER1_PALETTE_MAP,
+    .clips = {
+        { PLAYER1_IDLE_FRAMES, 2, 150, ANIM_LOOP },  // idle
+        { PLAYER1_WALK_N_FRAMES, 2, 60, ANIM_ONCE },  // walk_n
+        { PLAYER1_WALK_E_FRAMES, 2, 60, ANIM_ONCE },  // walk_e
+        { PLAYER1_WALK_S_FRAMES, 2, 60, ANIM_ONCE },  // walk_s
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { PLAYER1_BUMP_FRAMES, 2, 90, ANIM_ONCE },  // bump
+        { PLAYER1_CELEBRATE_FRAMES, 3, 140, ANIM_ONCE },  // celebrate
     }
 };
 
-// Player 2 complete sprite definition
+// =============================================================================
+// PLAYER2: 8x8, 2 bpp, 13 frame(s) in 6 clip(s), 239 bytes packed (1664 as RGB565)
+// Compiled (draw): ~1432 bytes of code (estimated, not measured), run from RAM
+// =============================================================================
+
+const uint8_t PROGMEM PLAYER2_PALETTE_MAP[] = { 7, 0, 3, 0 };
+
+// Frame 0 - Left arm down, right arm up
+const uint8_t PROGMEM PLAYER2_F0_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER2_F0_PIXELS[] = {
+    0x00, 0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F0_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
+
+// Frame 1 - Right arm down, left arm up
+const uint8_t PROGMEM PLAYER2_F1_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER2_F1_PIXELS[] = {
+    0x00, 0x60, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F1_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 2 - Back view, left leg up
+const uint8_t PROGMEM PLAYER2_F2_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER2_F2_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F2_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
+
+// Frame 3 - Back view, right leg up
+const uint8_t PROGMEM PLAYER2_F3_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER2_F3_PIXELS[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F3_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 4 - Leaning right, back leg out
+const uint8_t PROGMEM PLAYER2_F4_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3C, 0x7F, 0xBC, 0x24, 0x63,
+};
+const uint8_t PROGMEM PLAYER2_F4_PIXELS[] = {
+    0x00, 0x40, 0x02, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F4_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c1; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c2; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[6] = c0; dst[7] = c0;
+}
+
+// Frame 5 - Legs together
+const uint8_t PROGMEM PLAYER2_F5_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3C, 0xFE, 0x3D, 0x3C, 0x24,
+};
+const uint8_t PROGMEM PLAYER2_F5_PIXELS[] = {
+    0x00, 0x40, 0x02, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F5_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c1; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c2; dst[5] = c2; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+}
+
+// Frame 6 - Looking down, left leg up
+const uint8_t PROGMEM PLAYER2_F6_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0x3D, 0xFF, 0xBC, 0x26, 0x60,
+};
+const uint8_t PROGMEM PLAYER2_F6_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F6_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0;
+}
+
+// Frame 7 - Looking down, right leg up
+const uint8_t PROGMEM PLAYER2_F7_MASK[] = {
+    0x3C, 0x7E, 0x7E, 0xBC, 0xFF, 0x3D, 0x64, 0x06,
+};
+const uint8_t PROGMEM PLAYER2_F7_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F7_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 8 - Squashed against the wall
+const uint8_t PROGMEM PLAYER2_F8_MASK[] = {
+    0x00, 0x3C, 0x7E, 0x7E, 0xFF, 0xFF, 0x7E, 0x66,
+};
+const uint8_t PROGMEM PLAYER2_F8_PIXELS[] = {
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F8_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 9 - Flattened, eyes shut
+const uint8_t PROGMEM PLAYER2_F9_MASK[] = {
+    0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
+};
+const uint8_t PROGMEM PLAYER2_F9_PIXELS[] = {
+    0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F9_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    dst += 2 * MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c1; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c1; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[6] = c0; dst[7] = c0;
+}
+
+// Frame 10 - Arms up
+const uint8_t PROGMEM PLAYER2_F10_MASK[] = {
+    0xBD, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x24, 0x66,
+};
+const uint8_t PROGMEM PLAYER2_F10_PIXELS[] = {
+    0x00, 0x00, 0x24, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F10_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 11 - Jump
+const uint8_t PROGMEM PLAYER2_F11_MASK[] = {
+    0xFF, 0x7E, 0x7E, 0x3C, 0x3C, 0x24, 0x66, 0x00,
+};
+const uint8_t PROGMEM PLAYER2_F11_PIXELS[] = {
+    0x00, 0x00, 0x90, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F11_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0xF0F8F0;  // FFFF
+    const uint32_t c2 = 0x000000;  // 0000
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c2; dst[4] = c2; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+// Frame 12 - Arms up, wink
+const uint8_t PROGMEM PLAYER2_F12_MASK[] = {
+    0xBD, 0xFF, 0x7E, 0x3C, 0x3C, 0x3C, 0x24, 0x66,
+};
+const uint8_t PROGMEM PLAYER2_F12_PIXELS[] = {
+    0x00, 0x00, 0x18, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void __not_in_flash_func(PLAYER2_F12_DRAW)(uint32_t* dst) {
+    const uint32_t c0 = 0xF00000;  // F800
+    const uint32_t c1 = 0x000000;  // 0000
+    const uint32_t c2 = 0xF0F8F0;  // FFFF
+    dst[0] = c0; dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[0] = c0; dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c2; dst[5] = c0; dst[6] = c0; dst[7] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[3] = c1; dst[4] = c1; dst[5] = c0; dst[6] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[3] = c0; dst[4] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[2] = c0; dst[5] = c0;
+    dst += MATRIX_WIDTH;
+    dst[1] = c0; dst[2] = c0; dst[5] = c0; dst[6] = c0;
+}
+
+const SpriteFrame PROGMEM PLAYER2_IDLE_FRAMES[] = {
+    { PLAYER2_F0_MASK, PLAYER2_F0_PIXELS, PLAYER2_F0_DRAW, nullptr },
+    { PLAYER2_F1_MASK, PLAYER2_F1_PIXELS, PLAYER2_F1_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER2_WALK_N_FRAMES[] = {
+    { PLAYER2_F2_MASK, PLAYER2_F2_PIXELS, PLAYER2_F2_DRAW, nullptr },
+    { PLAYER2_F3_MASK, PLAYER2_F3_PIXELS, PLAYER2_F3_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER2_WALK_E_FRAMES[] = {
+    { PLAYER2_F4_MASK, PLAYER2_F4_PIXELS, PLAYER2_F4_DRAW, nullptr },
+    { PLAYER2_F5_MASK, PLAYER2_F5_PIXELS, PLAYER2_F5_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER2_WALK_S_FRAMES[] = {
+    { PLAYER2_F6_MASK, PLAYER2_F6_PIXELS, PLAYER2_F6_DRAW, nullptr },
+    { PLAYER2_F7_MASK, PLAYER2_F7_PIXELS, PLAYER2_F7_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER2_BUMP_FRAMES[] = {
+    { PLAYER2_F8_MASK, PLAYER2_F8_PIXELS, PLAYER2_F8_DRAW, nullptr },
+    { PLAYER2_F9_MASK, PLAYER2_F9_PIXELS, PLAYER2_F9_DRAW, nullptr },
+};
+
+const SpriteFrame PROGMEM PLAYER2_CELEBRATE_FRAMES[] = {
+    { PLAYER2_F10_MASK, PLAYER2_F10_PIXELS, PLAYER2_F10_DRAW, nullptr },
+    { PLAYER2_F11_MASK, PLAYER2_F11_PIXELS, PLAYER2_F11_DRAW, nullptr },
+    { PLAYER2_F12_MASK, PLAYER2_F12_PIXELS, PLAYER2_F12_DRAW, nullptr },
+};
+
 const SpriteDefinition PLAYER2_SPRITE PROGMEM = {
     .width = 8,
     .height = 8,
-    .idle = {
-        .frames = P2_IDLE_FRAMES,
-        .frame_count = 2,
-        .frame_duration_ms = 150  // Fast animation (0.3s cycle)
+    .bpp = 2,
+    .palette_map = PLAYER2_PALETTE_MAP,
+    .clips = {
+        { PLAYER2_IDLE_FRAMES, 2, 150, ANIM_LOOP },  // idle
+        { PLAYER2_WALK_N_FRAMES, 2, 60, ANIM_ONCE },  // walk_n
+        { PLAYER2_WALK_E_FRAMES, 2, 60, ANIM_ONCE },  // walk_e
+        { PLAYER2_WALK_S_FRAMES, 2, 60, ANIM_ONCE },  // walk_s
+        { nullptr, 0, 0, 0 },  // walk_w (none)
+        { PLAYER2_BUMP_FRAMES, 2, 90, ANIM_ONCE },  // bump
+        { PLAYER2_CELEBRATE_FRAMES, 3, 140, ANIM_ONCE },  // celebrate
     }
 };
 
@@ -1,68 +1,92 @@
 // sprites/sprite.cpp
 // Sprite renderer implementation
 #include "sprite.h"
+#include "sprite_cache.h"
+#include "../config.h"
+
+uint32_t SpriteRenderer::clock = 0;
+uint32_t SpriteRenderer::frame_interval_us = FRAME_INTERVAL_US;
 
 void SpriteRenderer::initInstance(SpriteInstance* instance, const SpriteDefinition* def) {
     instance->definition = def;
-    instance->current_frame = 0;
-    instance->last_frame_time = millis();
+    play(instance, CLIP_IDLE);
 }
 
-const uint16_t* SpriteRenderer::getCurrentFrame(const SpriteInstance* instance) {
-    const SpriteAnimation* anim = &instance->definition->idle;
+void SpriteRenderer::play(SpriteInstance* instance, SpriteClip clip, uint8_t transform) {
+    const SpriteAnimation* anim = &instance->definition->clips[clip];
+    if (anim->frame_count == 0) {
+        // One side view covers both horizontal facings
+        if (clip != CLIP_WALK_E && clip != CLIP_WALK_W) return;
+        clip = (clip == CLIP_WALK_E) ? CLIP_WALK_W : CLIP_WALK_E;
+        anim = &instance->definition->clips[clip];
+        if (anim->frame_count == 0) return;
+        transform ^= XFORM_FLIP_H;
+    }
 
-    // frames is a pointer to an array of pointers in PROGMEM
-    const uint16_t* const* frame_array = anim->frames;
-    return (const uint16_t*)pgm_read_ptr(&frame_array[instance->current_frame]);
+    // Convert the clip's frame time to clock ticks once, not every frame
+    uint32_t ticks = (uint32_t)anim->frame_duration_ms * 1000 / frame_interval_us;
+    instance->clip = clip;
+    instance->current_frame = 0;
+    instance->frame_ticks = ticks > 0 ? ticks : 1;
+    instance->clip_start = clock;
+    instance->transform = transform;
 }
 
-void SpriteRenderer::updateAnimation(SpriteInstance* instance) {
-    const SpriteAnimation* anim = &instance->definition->idle;
-    uint32_t now = millis();
+void SpriteRenderer::tick(SpriteInstance* const* instances, uint8_t count) {
+    clock++;
 
+    for (uint8_t i = 0; i < count; i++) {
+        SpriteInstance* instance = instances[i];
+        const SpriteAnimation* anim = &instance->definition->clips[instance->clip];
+        uint32_t frame = (clock - instance->clip_start) / instance->frame_ticks;
 
-    if (now - instance->last_frame_time >= anim->frame_duration_ms) {
-        instance->current_frame = (instance->current_frame + 1) % anim->frame_count;
-        instance->last_frame_time = now;
+        if (frame < anim->frame_count) {
+            instance->current_frame = frame;
+        } else if (anim->flags & ANIM_LOOP) {
+            instance->current_frame = frame % anim->frame_count;
+        } else {
+            play(instance, CLIP_IDLE);
+        }
     }
 }
 
+const SpriteFrame* SpriteRenderer::getFrame(const SpriteInstance* instance) {
+    return &instance->definition->clips[instance->clip].frames[instance->current_frame];
+}
+
 void SpriteRenderer::draw(DisplayManager* display, const SpriteInstance* instance,
                           int16_t x, int16_t y) {
-    const uint16_t* frame = getCurrentFrame(instance);
-    uint8_t w = instance->definition->width;
-    uint8_t h = instance->definition->height;
-
-    // Draw pixel by pixel with transparency check
-    for (uint8_t py = 0; py < h; py++) {
-        for (uint8_t px = 0; px < w; px++) {
-            // Read color from PROGMEM
-            uint16_t color = pgm_read_word(&frame[py * w + px]);
-
-            // Skip transparent pixels
-            if (color != TRANSPARENT_COLOR) {
-                display->drawPixel(x + px, y + py, color);
-            }
-        }
-    }
+    blit(display, instance, x, y, SPRITE_CACHE_NO_TINT);
 }
 
 void SpriteRenderer::drawWithColorTint(DisplayManager* display, const SpriteInstance* instance,
                                         int16_t x, int16_t y, uint16_t tint_color) {
-    const uint16_t* frame = getCurrentFrame(instance);
-    uint8_t w = instance->definition->width;
-    uint8_t h = instance->definition->height;
-
-    // Draw pixel by pixel, replacing non-transparent pixels with tint color
-    for (uint8_t py = 0; py < h; py++) {
-        for (uint8_t px = 0; px < w; px++) {
+    blit(display, instance, x, y, tint_color);
+}
 
-            uint16_t pixel = pgm_read_word(&frame[py * w + px]);
+void SpriteRenderer::blit(DisplayManager* display, const SpriteInstance* instance,
+                          int16_t x, int16_t y, uint32_t tint) {
+    const SpriteDefinition* def = instance->definition;
+    const SpriteFrame* src = getFrame(instance);
 
-            // Replace non-transparent pixels with tint color
-            if (pixel != TRANSPARENT_COLOR) {
-                display->drawPixel(x + px, y + py, tint_color);
+    // Compiled frame: straight-line stores, valid only unclipped and untransformed
+    if (instance->transform == XFORM_NONE) {
+        SpriteDrawFn draw = (SpriteDrawFn)pgm_read_ptr(&src->draw);
+        SpriteFillFn fill = (SpriteFillFn)pgm_read_ptr(&src->fill);
+        bool tinted = (tint != SPRITE_CACHE_NO_TINT);
+        if (tinted ? fill != nullptr : draw != nullptr) {
+            uint32_t* dst = display->getBlockTarget(x, y, def->width, def->height);
+            if (dst != nullptr) {
+                if (tinted) {
+                    fill(dst, DisplayManager::toNativeColor(tint));
+                } else {
+                    draw(dst);
+                }
+                return;
             }
         }
     }
+
+    const CachedSpriteFrame* frame = SpriteCache::get(def, src, tint);
+    display->drawBlock8(x, y, frame->mask, frame->pixels, def->width, def->height, instance->transform);
 }
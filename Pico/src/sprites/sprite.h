@@ -1,33 +1,76 @@
 // sprites/sprite.h
-// Sprite system with animation support for RGB565 displays
+// Sprite system with animation support for palette-indexed sprites
+// Sprite data is generated from assets/sprites/*.sprite by tools/sprite_pipeline.py
 #ifndef SPRITE_H
 #define SPRITE_H
 
 #include <Arduino.h>
 #include "../display/display_manager.h"
 
-// Transparency marker - magenta
-#define TRANSPARENT_COLOR 0xF81F  // RGB565 magenta (R=31, G=0, B=31)
+// Compiled frames (sprites with `compile:` in their asset) are straight-line
+// functions that store the opaque pixels relative to dst, the sprite's top-left
+// framebuffer pixel. They are placed in RAM on the Pico; host builds ignore it.
+#ifndef __not_in_flash_func
+#define __not_in_flash_func(func_name) func_name
+#endif
+typedef void (*SpriteDrawFn)(uint32_t* dst);                   // Own colors, folded in
+typedef void (*SpriteFillFn)(uint32_t* dst, uint32_t color);   // Every opaque pixel = color
+
+// One packed frame (PROGMEM). Transparency is a per-row opacity mask, so only
+// opaque pixels have index data and drawing walks set bits only:
+//   mask:   one byte per row, bit 7 = leftmost pixel (sprites are <= 8 wide)
+//   pixels: local palette indices of the opaque pixels in row order,
+//           bpp bits each, packed LSB-first
+//   draw/fill: compiled versions of this frame, nullptr if not compiled
+struct SpriteFrame {
+    const uint8_t* mask;
+    const uint8_t* pixels;
+    SpriteDrawFn draw;
+    SpriteFillFn fill;
+};
+
+// Named animation clips, in SpriteDefinition::clips order (tools/sprite_pipeline.py CLIPS)
+enum SpriteClip : uint8_t {
+    CLIP_IDLE = 0,
+    CLIP_WALK_N,            // CLIP_WALK_N + Direction gives the walk clip for a move
+    CLIP_WALK_E,
+    CLIP_WALK_S,
+    CLIP_WALK_W,
+    CLIP_BUMP,              // Tried to move into a wall
+    CLIP_CELEBRATE,         // Reached the goal
+    SPRITE_CLIP_COUNT
+};
+
+// Clip flags
+#define ANIM_ONCE  0x00     // Play through, then fall back to idle
+#define ANIM_LOOP  0x01     // Repeat until another clip is played
 
 // Single animation sequence
 struct SpriteAnimation {
-    const uint16_t* const* frames;  // Pointer to array of frame pointers (PROGMEM)
+    const SpriteFrame* frames;      // Array of packed frames (PROGMEM), nullptr if the clip is absent
     uint8_t frame_count;            // Number of frames in this animation
     uint16_t frame_duration_ms;     // Milliseconds per frame
+    uint8_t flags;                  // ANIM_LOOP / ANIM_ONCE
 };
 
 // Complete sprite definition
 struct SpriteDefinition {
-    uint8_t width;              // Sprite width in pixels (typically 8)
-    uint8_t height;             // Sprite height in pixels (typically 8)
-    SpriteAnimation idle;       // Idle animation
+    uint8_t width;              // Sprite width in pixels (at most 8)
+    uint8_t height;             // Sprite height in pixels (at most 8)
+    uint8_t bpp;                // Bits per pixel index: 2 or 4
+    const uint8_t* palette_map; // Local index -> SPRITE_PALETTE index (1 << bpp entries)
+    SpriteAnimation clips[SPRITE_CLIP_COUNT];  // Indexed by SpriteClip
 };
 
-// Runtime sprite state (per-player instance)
+// Runtime sprite state (per-player instance). Frames are derived from the
+// shared animation clock, so an instance holds no timer of its own.
 struct SpriteInstance {
     const SpriteDefinition* definition;  // Pointer to sprite definition
-    uint8_t current_frame;               // Current frame index
-    uint32_t last_frame_time;            // millis() of last frame change
+    uint8_t clip;                        // SpriteClip being played
+    uint8_t current_frame;               // Frame index within the clip
+    uint16_t frame_ticks;                // Clock ticks per frame for this clip
+    uint32_t clip_start;                 // Clock tick the clip started on
+    uint8_t transform;                   // BlockTransform applied while blitting
 };
 
 // Sprite renderer class
@@ -35,10 +78,21 @@ class SpriteRenderer {
 public:
     static void initInstance(SpriteInstance* instance, const SpriteDefinition* def);
 
-    // Update animation frame based on elapsed time
-    static void updateAnimation(SpriteInstance* instance);
+    // Start a clip from its first frame, drawn with `transform` (BlockTransform).
+    // A missing walk_w/walk_e clip is played as its mirror image; any other
+    // missing clip is ignored.
+    static void play(SpriteInstance* instance, SpriteClip clip, uint8_t transform = XFORM_NONE);
 
-    // Render sprite at pixel coordinates (not cell coordinates)
+    // Advance the shared animation clock by one rendered frame and bring every
+    // instance up to date in a single pass (finished one-shot clips fall back to idle)
+    static void tick(SpriteInstance* const* instances, uint8_t count);
+
+    // Frame the instance shows right now
+    static const SpriteFrame* getFrame(const SpriteInstance* instance);
+
+    // Render sprite at pixel coordinates (not cell coordinates). Compiled frames
+    // run directly when fully on screen and untransformed; otherwise the frame
+    // comes decoded from SpriteCache and is a masked copy from SRAM
     static void draw(DisplayManager* display, const SpriteInstance* instance,
                      int16_t x, int16_t y);
 
@@ -46,9 +100,16 @@ public:
     static void drawWithColorTint(DisplayManager* display, const SpriteInstance* instance,
                                    int16_t x, int16_t y, uint16_t tint_color);
 
+    // Shared path of draw/drawWithColorTint: tint is RGB565 or SPRITE_CACHE_NO_TINT
+    static void blit(DisplayManager* display, const SpriteInstance* instance,
+                     int16_t x, int16_t y, uint32_t tint);
+
+    // Frame interval the clock ticks at; clips started afterwards keep their ms timing
+    static void setFrameInterval(uint32_t us) { frame_interval_us = us; }
+
 private:
-    // Get current frame pointer from animation
-    static const uint16_t* getCurrentFrame(const SpriteInstance* instance);
+    static uint32_t clock;  // Rendered frames since boot
+    static uint32_t frame_interval_us;
 };
 
 #endif // SPRITE_H
@@ -0,0 +1,57 @@
+// sprites/sprite_batch.cpp
+// Sprite batch implementation
+#include "sprite_batch.h"
+
+static_assert(SPRITE_BATCH_CAPACITY <= 256, "sort keys hold the entry index in 8 bits");
+
+SpriteBatch::SpriteBatch() {
+    begin();
+}
+
+void SpriteBatch::begin() {
+    count = 0;
+    culled = 0;
+    dropped = 0;
+}
+
+bool SpriteBatch::submit(const SpriteInstance* sprite, int16_t x, int16_t y, uint8_t z, uint32_t tint) {
+    // The one screen test per sprite: anything left is clipped once at raster time
+    const SpriteDefinition* def = sprite->definition;
+    if (x >= MATRIX_WIDTH || y >= MATRIX_HEIGHT || x + def->width <= 0 || y + def->height <= 0) {
+        culled++;
+        return false;
+    }
+    if (count >= SPRITE_BATCH_CAPACITY) {
+        dropped++;
+        return false;
+    }
+
+    SpriteBatchEntry& e = entries[count];
+    e.sprite = sprite;
+    e.x = x;
+    e.y = y;
+    e.tint = tint;
+    order[count] = ((uint16_t)z << 8) | count;
+    count++;
+    return true;
+}
+
+void SpriteBatch::flush(DisplayManager* display) {
+    // Insertion sort: a few dozen keys, usually submitted nearly in z order.
+    // The index in the low byte makes equal z stable.
+    for (uint8_t i = 1; i < count; i++) {
+        uint16_t key = order[i];
+        uint8_t j = i;
+        while (j > 0 && order[j - 1] > key) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = key;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        const SpriteBatchEntry& e = entries[order[i] & 0xFF];
+        SpriteRenderer::blit(display, e.sprite, e.x, e.y, e.tint);
+    }
+    count = 0;
+}
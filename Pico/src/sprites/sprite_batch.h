@@ -0,0 +1,45 @@
+// sprites/sprite_batch.h
+// Sprite batch: collect a frame's sprites, sort them by z once, then
+// rasterize each one clipped once against the screen
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "sprite.h"
+#include "sprite_cache.h"
+
+struct SpriteBatchEntry {
+    const SpriteInstance* sprite;
+    int16_t x, y;               // Top-left pixel
+    uint32_t tint;              // RGB565 or SPRITE_CACHE_NO_TINT
+};
+
+class SpriteBatch {
+private:
+    SpriteBatchEntry entries[SPRITE_BATCH_CAPACITY];
+    uint16_t order[SPRITE_BATCH_CAPACITY];  // (z << 8) | entry index, sorted at flush
+    uint8_t count;
+    uint8_t culled;             // Entirely off screen, dropped at submit
+    uint8_t dropped;            // Batch full
+
+public:
+    SpriteBatch();
+
+    // Start a new frame's batch
+    void begin();
+
+    // Queue a sprite; higher z draws on top, equal z keeps submission order.
+    // Returns false if it was culled (off screen) or the batch is full.
+    bool submit(const SpriteInstance* sprite, int16_t x, int16_t y, uint8_t z,
+                uint32_t tint = SPRITE_CACHE_NO_TINT);
+
+    // Sort and rasterize everything queued, then empty the batch
+    void flush(DisplayManager* display);
+
+    uint8_t getCount() const { return count; }
+    uint8_t getCulled() const { return culled; }
+    uint8_t getDropped() const { return dropped; }
+};
+
+#endif // SPRITE_BATCH_H
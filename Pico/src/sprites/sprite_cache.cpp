@@ -0,0 +1,103 @@
+// sprites/sprite_cache.cpp
+// Sprite frame cache implementation
+#include "sprite_cache.h"
+#include "sprite_palette.h"
+#include "../serial_log.h"
+
+CachedSpriteFrame SpriteCache::entries[SPRITE_CACHE_ENTRIES];
+uint32_t SpriteCache::clock = 0;
+uint32_t SpriteCache::hits = 0;
+uint32_t SpriteCache::misses = 0;
+
+void SpriteCache::clear() {
+    for (uint8_t i = 0; i < SPRITE_CACHE_ENTRIES; i++) {
+        entries[i].frame = nullptr;
+        entries[i].last_used = 0;
+    }
+    clock = 0;
+    hits = 0;
+    misses = 0;
+}
+
+const CachedSpriteFrame* SpriteCache::get(const SpriteDefinition* def, const SpriteFrame* frame,
+                                          uint32_t tint) {
+    clock++;
+
+    // Linear scan: the table is small and this is cheaper than hashing on the M0+
+    CachedSpriteFrame* victim = &entries[0];
+    for (uint8_t i = 0; i < SPRITE_CACHE_ENTRIES; i++) {
+        CachedSpriteFrame* e = &entries[i];
+        if (e->frame == frame && e->tint == tint) {
+            e->last_used = clock;
+            hits++;
+            return e;
+        }
+        if (e->last_used < victim->last_used) victim = e;  // Free slots are stamped 0
+    }
+
+    misses++;
+    decode(victim, def, frame, tint);
+    victim->last_used = clock;
+    return victim;
+}
+
+void SpriteCache::prewarm(const SpriteDefinition* def, uint32_t tint) {
+    for (uint8_t c = 0; c < SPRITE_CLIP_COUNT; c++) {
+        const SpriteAnimation* anim = &def->clips[c];
+        for (uint8_t f = 0; f < anim->frame_count; f++) {
+            get(def, &anim->frames[f], tint);
+        }
+    }
+}
+
+void SpriteCache::decode(CachedSpriteFrame* entry, const SpriteDefinition* def,
+                         const SpriteFrame* frame, uint32_t tint) {
+    const uint8_t* mask = (const uint8_t*)pgm_read_ptr(&frame->mask);
+    const uint8_t* pixels = (const uint8_t*)pgm_read_ptr(&frame->pixels);
+    uint8_t bpp = def->bpp;
+
+    // Local palette -> native colors, or every index -> the tint
+    uint32_t colors[16];
+    uint8_t color_count = 1 << bpp;
+    for (uint8_t i = 0; i < color_count; i++) {
+        uint16_t rgb565 = (tint == SPRITE_CACHE_NO_TINT)
+            ? pgm_read_word(&SPRITE_PALETTE[pgm_read_byte(&def->palette_map[i])])
+            : (uint16_t)tint;
+        colors[i] = DisplayManager::toNativeColor(rgb565);
+    }
+
+    entry->frame = frame;
+    entry->tint = tint;
+    memset(entry->mask, 0, sizeof(entry->mask));
+    memset(entry->pixels, 0, sizeof(entry->pixels));
+
+    uint8_t index_mask = color_count - 1;
+    uint8_t bits = 0;
+    uint8_t bits_left = 0;
+    for (uint8_t py = 0; py < def->height; py++) {
+        uint8_t m = pgm_read_byte(&mask[py]);
+        entry->mask[py] = m;
+        while (m) {
+            uint8_t px = __builtin_clz((uint32_t)m) - 24;
+            m &= ~(0x80 >> px);
+            if (bits_left == 0) {
+                bits = pgm_read_byte(pixels++);
+                bits_left = 8;
+            }
+            entry->pixels[py * 8 + px] = colors[bits & index_mask];
+            bits >>= bpp;
+            bits_left -= bpp;
+        }
+    }
+}
+
+void SpriteCache::printStats() {
+    uint32_t total = hits + misses;
+    Log.print("[SPRITES] Cache hits ");
+    Log.print((int)hits);
+    Log.print(", misses ");
+    Log.print((int)misses);
+    Log.print(" (");
+    Log.print(total ? (int)((uint64_t)hits * 100 / total) : 0);
+    Log.println("% hit)");
+}
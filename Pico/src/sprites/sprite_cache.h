@@ -0,0 +1,49 @@
+// sprites/sprite_cache.h
+// SRAM cache of decoded sprite frames: indices resolved through the palette
+// and converted to native framebuffer colors once, so drawing never touches flash
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <Arduino.h>
+#include "../config.h"
+#include "sprite.h"
+
+#define SPRITE_CACHE_NO_TINT 0xFFFFFFFFu  // Key for frames drawn in their own colors
+
+// One decoded frame, 8x8 max (see SpriteFrame)
+struct CachedSpriteFrame {
+    const SpriteFrame* frame;     // Source frame (unique across definitions), nullptr = free slot
+    uint32_t tint;                // RGB565 tint, or SPRITE_CACHE_NO_TINT
+    uint32_t last_used;           // LRU stamp
+    uint8_t mask[8];              // Row opacity masks, bit 7 = leftmost pixel
+    uint32_t pixels[64];          // Native colors, row-major, 8 per row
+};
+
+class SpriteCache {
+public:
+    // Decoded frame for (frame, tint); decodes it with def's palette into the
+    // least recently used slot on a miss
+    static const CachedSpriteFrame* get(const SpriteDefinition* def, const SpriteFrame* frame,
+                                        uint32_t tint);
+
+    // Decode every frame of every clip of def ahead of time
+    static void prewarm(const SpriteDefinition* def, uint32_t tint);
+
+    // Drop all entries and zero the counters
+    static void clear();
+
+    static uint32_t getHits() { return hits; }
+    static uint32_t getMisses() { return misses; }
+    static void printStats();
+
+private:
+    static CachedSpriteFrame entries[SPRITE_CACHE_ENTRIES];
+    static uint32_t clock;
+    static uint32_t hits;
+    static uint32_t misses;
+
+    static void decode(CachedSpriteFrame* entry, const SpriteDefinition* def,
+                       const SpriteFrame* frame, uint32_t tint);
+};
+
+#endif // SPRITE_CACHE_H
@@ -0,0 +1,24 @@
+// sprites/sprite_palette.h
+// Shared RGB565 sprite palette
+// GENERATED by tools/sprite_pipeline.py from assets/sprites/goal.sprite, assets/sprites/hazard.sprite, assets/sprites/key.sprite, assets/sprites/player1.sprite, assets/sprites/player2.sprite, assets/sprites/trap.sprite - do not edit
+#ifndef SPRITE_PALETTE_H
+#define SPRITE_PALETTE_H
+
+#include <Arduino.h>
+
+#define SPRITE_PALETTE_SIZE 10
+
+const uint16_t PROGMEM SPRITE_PALETTE[SPRITE_PALETTE_SIZE] = {
+    0xFFFF,  // 0
+    0x2104,  // 1
+    0xFA00,  // 2
+    0x0000,  // 3
+    0xFFE0,  // 4
+    0xC300,  // 5
+    0x5F0B,  // 6
+    0xF800,  // 7
+    0x8410,  // 8
+    0x4208,  // 9
+};
+
+#endif // SPRITE_PALETTE_H
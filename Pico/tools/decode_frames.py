@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Decode framebuffer captures streamed by the Pico (serial 'C' / 'X' commands).
+
+Reads a raw serial log (file, '-' for stdin, or a serial device such as
+/dev/ttyACM0), finds every frame packet between the text log lines, and
+writes each one as PNG or PPM.
+
+    python3 tools/decode_frames.py /dev/ttyACM0 --out frames/
+    python3 tools/decode_frames.py capture.bin --format ppm --scale 8
+
+Packet layout is documented in src/display/frame_capture.h. Only the Python
+standard library is needed (pyserial is used for device paths if installed).
+"""
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = b"\xa5FRM"
+HEADER = struct.Struct("<HBBBH")  # frame_no, width, height, palette-1, run_count
+
+
+def parse_packet(buf, start):
+    """Return (frame_no, width, height, rgb_bytes, end) or None if incomplete/corrupt."""
+    pos = start + len(MAGIC)
+    if len(buf) < pos + HEADER.size:
+        return None
+    frame_no, width, height, pal_m1, run_count = HEADER.unpack_from(buf, pos)
+    palette_count = pal_m1 + 1
+    body = pos + HEADER.size
+    end = body + palette_count * 3 + run_count * 2 + 1
+    if len(buf) < end:
+        return None
+
+    checksum = 0
+    for b in buf[pos:end - 1]:
+        checksum ^= b
+    if checksum != buf[end - 1]:
+        return "corrupt", end
+
+    palette = [bytes(buf[body + i * 3: body + i * 3 + 3]) for i in range(palette_count)]
+    runs = body + palette_count * 3
+    out = bytearray()
+    for r in range(run_count):
+        length = buf[runs + r * 2] + 1
+        index = buf[runs + r * 2 + 1]
+        out += palette[min(index, palette_count - 1)] * length
+
+    if len(out) != width * height * 3:
+        return "corrupt", end
+    return frame_no, width, height, bytes(out), end
+
+
+def scale_rgb(rgb, width, height, scale):
+    if scale == 1:
+        return rgb, width, height
+    rows = []
+    for y in range(height):
+        row = rgb[y * width * 3:(y + 1) * width * 3]
+        wide = b"".join(row[x * 3:x * 3 + 3] * scale for x in range(width))
+        rows.append(wide * scale)
+    return b"".join(rows), width * scale, height * scale
+
+
+def write_ppm(path, rgb, width, height):
+    with open(path, "wb") as f:
+        f.write(b"P6\n%d %d\n255\n" % (width, height))
+        f.write(rgb)
+
+
+def write_png(path, rgb, width, height):
+    def chunk(tag, data):
+        c = struct.pack(">I", len(data)) + tag + data
+        return c + struct.pack(">I", zlib.crc32(tag + data) & 0xFFFFFFFF)
+
+    raw = b"".join(b"\x00" + rgb[y * width * 3:(y + 1) * width * 3] for y in range(height))
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def open_source(path):
+    if path == "-":
+        return sys.stdin.buffer
+    if path.startswith("/dev/"):
+        try:
+            import serial  # pyserial
+            return serial.Serial(path, 115200, timeout=0.5)
+        except ImportError:
+            pass
+    return open(path, "rb")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("source", help="capture file, serial device, or - for stdin")
+    ap.add_argument("--out", default="frames", help="output directory (default: frames)")
+    ap.add_argument("--format", choices=("png", "ppm"), default="png")
+    ap.add_argument("--scale", type=int, default=4, help="integer upscale factor (default: 4)")
+    args = ap.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    src = open_source(args.source)
+    buf = bytearray()
+    frames = corrupt = 0
+    last_time = time.time()
+
+    while True:
+        data = src.read(4096)
+        if not data:
+            if args.source.startswith("/dev/"):
+                continue  # Device: keep waiting for the next frame
+            break
+        buf += data
+
+        while True:
+            start = buf.find(MAGIC)
+            if start < 0:
+                del buf[:-(len(MAGIC) - 1)]  # Keep a possible partial magic
+                break
+            result = parse_packet(buf, start)
+            if result is None:
+                del buf[:start]
+                break
+            if result[0] == "corrupt":
+                corrupt += 1
+                del buf[:start + 1]  # Resync on the next magic
+                continue
+
+            frame_no, width, height, rgb, end = result
+            size = end - start
+            rgb, w, h = scale_rgb(rgb, width, height, args.scale)
+            path = os.path.join(args.out, "frame_%05d.%s" % (frame_no, args.format))
+            (write_png if args.format == "png" else write_ppm)(path, rgb, w, h)
+
+            now = time.time()
+            print("frame %5d: %5d bytes (%.1fx smaller than raw), %6.1f ms since previous -> %s"
+                  % (frame_no, size, width * height * 3 / size, (now - last_time) * 1e3, path))
+            last_time = now
+            frames += 1
+            del buf[:end]
+
+    print("%d frame(s) decoded, %d corrupt packet(s) skipped" % (frames, corrupt))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,182 @@
+// tools/headless.cpp
+// Runs the game on a Linux host with no panel: a scripted session is played on
+// a manual 60 Hz clock and every rendered frame goes through the host HUB75
+// backend (host/hub75_host.c) to an ANSI truecolor terminal or PPM files.
+//
+// Build (from Pico/):
+//   g++ -O2 -std=gnu++17 -Ihost -Isrc -Ilib/RP2040Matrix tools/headless.cpp
+//       src/game/*.cpp src/sprites/*.cpp src/effects/*.cpp src/display/*.cpp
+//       lib/RP2040Matrix/GFXMatrix.cpp host/*.cpp host/*.c -o /tmp/headless
+//
+// Usage:
+//   /tmp/headless [--term [FILE] | --ppm DIR] [--every N] [--frames N]
+//                 [--step N] [--seed S] [--realtime] [--input SCRIPT]
+//                 [--persistent] [--check]
+//
+// SCRIPT is one command per --step frames (default 30):
+//   U/H/J/K  move up/left/down/right (any of them starts from the start screen)
+//   R reset, W win trigger, + / - D9 held / released, . wait
+// The session ends after --frames frames (default: script length + 2 s).
+// --persistent plays on a carved maze; --check fails the run if a hazard ever
+// steps through a closed wall (or off the grid).
+// Example: /tmp/headless --term --realtime --input "U.KKJJHH..W"
+#include <Arduino.h>
+#include <chrono>
+#include <thread>
+#include "config.h"
+#include "display/display_manager.h"
+#include "game/game_state.h"
+
+extern "C" {
+    #include "hub75.h"
+}
+
+static DisplayManager display;
+static GameState game;
+
+static const int8_t DX[4] = { 0, 1, 0, -1 };
+static const int8_t DY[4] = { -1, 0, 1, 0 };
+
+// Hazard steps (from cells before the update) that no passage allows
+static uint32_t hazard_steps = 0;
+
+static uint32_t checkHazards(const uint8_t* before_x, const uint8_t* before_y, uint8_t count) {
+    EntityPool& pool = game.getEntities();
+    MazeGenerator& maze = game.getMaze();
+    uint32_t crossings = 0;
+    for (uint8_t i = 0; i < count && i < pool.getCount(); i++) {
+        if (pool.getType(i) != ENTITY_HAZARD) continue;
+        uint8_t x = before_x[i], y = before_y[i];
+        if (pool.getX(i) == x && pool.getY(i) == y) continue;
+        hazard_steps++;
+
+        // The carved walls themselves, not the boards the hazards stepped by
+        uint8_t open = maze.isPersistent() ? maze.getWalls().openings(x, y) : 0x0F;
+        bool ok = false;
+        for (uint8_t d = 0; d < 4; d++) {
+            if ((open & (1 << d)) && x + DX[d] == pool.getX(i) && y + DY[d] == pool.getY(i)) ok = true;
+        }
+        if (!ok) {
+            fprintf(stderr, "hazard %u: (%u,%u) -> (%u,%u) through a wall\n", i, x, y,
+                    pool.getX(i), pool.getY(i));
+            crossings++;
+        }
+    }
+    return crossings;
+}
+
+static Direction keyDirection(char c) {
+    switch (c) {
+        case 'U': return NORTH;
+        case 'H': return WEST;
+        case 'J': return SOUTH;
+        case 'K': return EAST;
+        default:  return DIR_NONE;
+    }
+}
+
+int main(int argc, char** argv) {
+    int mode = HUB75_HOST_NONE;
+    const char* path = nullptr;
+    const char* script = "";
+    int every = 1;
+    long frames = -1;
+    int step = 30;
+    unsigned long seed = 1;
+    bool realtime = false;
+    bool persistent = false;
+    bool check = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        bool has_value = i + 1 < argc;
+        if (!strcmp(a, "--term")) {
+            mode = HUB75_HOST_TERMINAL;
+            if (has_value && argv[i + 1][0] != '-') path = argv[++i];
+        } else if (!strcmp(a, "--ppm") && has_value) {
+            mode = HUB75_HOST_PPM;
+            path = argv[++i];
+        } else if (!strcmp(a, "--every") && has_value) {
+            every = atoi(argv[++i]);
+        } else if (!strcmp(a, "--frames") && has_value) {
+            frames = atol(argv[++i]);
+        } else if (!strcmp(a, "--step") && has_value) {
+            step = max(1, atoi(argv[++i]));
+        } else if (!strcmp(a, "--seed") && has_value) {
+            seed = strtoul(argv[++i], nullptr, 0);
+        } else if (!strcmp(a, "--input") && has_value) {
+            script = argv[++i];
+        } else if (!strcmp(a, "--realtime")) {
+            realtime = true;
+        } else if (!strcmp(a, "--persistent")) {
+            persistent = true;
+        } else if (!strcmp(a, "--check")) {
+            check = true;
+        } else {
+            fprintf(stderr, "usage: %s [--term [FILE] | --ppm DIR] [--every N] [--frames N]\n"
+                            "       [--step N] [--seed S] [--realtime] [--input SCRIPT]\n"
+                            "       [--persistent] [--check]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    long script_len = (long)strlen(script);
+    if (frames < 0) frames = script_len * step + 2 * 1000000L / FRAME_INTERVAL_US;
+
+    hostUseManualClock(0);
+    if (hub75_host_output(mode, path, every) != 0) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    display.init();
+    randomSeed(seed);
+    game.getMaze().setPersistent(persistent);
+    game.init();
+
+    bool d9_held = true;
+    uint32_t crossings = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (long f = 0; f < frames; f++) {
+        // Same order as loop(): input first, then one update + render per frame
+        if (f % step == 0 && f / step < script_len) {
+            char c = script[f / step];
+            Direction dir = keyDirection(c);
+            if (dir != DIR_NONE) {
+                game.handleInput(dir);
+                game.getLastMoveResult();   // The ack would go to the R4
+                game.finishMove();
+            } else if (c == 'R') {
+                game.init();
+            } else if (c == 'W') {
+                game.triggerWin();
+            } else if (c == '+' || c == '-') {
+                d9_held = (c == '+');
+            }
+        }
+
+        uint8_t before_x[ENTITY_CAPACITY], before_y[ENTITY_CAPACITY];
+        uint8_t before_count = game.getEntities().getCount();
+        for (uint8_t i = 0; i < before_count; i++) {
+            before_x[i] = game.getEntities().getX(i);
+            before_y[i] = game.getEntities().getY(i);
+        }
+        game.update();
+        if (check) crossings += checkHazards(before_x, before_y, before_count);
+        game.render(&display, d9_held);
+        game.prepareMoves();
+
+        hostAdvanceMicros(FRAME_INTERVAL_US);
+        if (realtime) std::this_thread::sleep_for(std::chrono::microseconds(FRAME_INTERVAL_US));
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    fprintf(stderr, "%lu frames (%lu written) in %.3f s: %.0f frames/s, %.1f us/frame\n",
+            hub75_host_frames(), hub75_host_presented(), seconds,
+            hub75_host_frames() / seconds, seconds * 1e6 / max(1UL, hub75_host_frames()));
+    if (check) {
+        fprintf(stderr, "hazard check (%s maze): %u steps, %u through walls\n",
+                persistent ? "persistent" : "memoryless", hazard_steps, crossings);
+        if (crossings) return 1;
+    }
+    return 0;
+}
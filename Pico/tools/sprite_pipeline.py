@@ -0,0 +1,549 @@
+#!/usr/bin/env python3
+"""Sprite asset pipeline: assets/sprites/*.sprite -> packed indexed sprite headers.
+
+Each .sprite file describes one sprite: a small palette and one or more
+animation clips (`animation: <clip> <frame_ms> [loop|once]`, clip names in
+CLIPS below). A clip's frames follow its animation line, either drawn inline
+as ASCII pixel art or sliced from a PNG strip (`image: file.png`, frames laid
+out left to right, alpha < 128 or magenta F81F = transparent). Idle loops by
+default, every other clip plays once. The pipeline:
+
+  * merges every sprite's colors into one shared RGB565 palette
+    (src/sprites/sprite_palette.h),
+  * gives each sprite a 4- or 16-entry local palette map, so pixels are
+    stored as 2 or 4 bpp indices,
+  * stores transparency as a per-row opacity bitmask, so only opaque pixels
+    are packed and the renderer walks set bits instead of testing pixels,
+  * optionally (`compile: draw`, `compile: tint` or both) turns every frame
+    into straight-line code that stores only the opaque pixels, with offsets
+    and native colors folded in; the renderer calls it through the frame
+    table whenever the sprite is fully on screen and untransformed,
+  * writes one header per `header:` group (e.g. src/sprites/player_sprites.h).
+
+Runs automatically before every PlatformIO build (extra_scripts in
+platformio.ini) and only rewrites headers whose content changed. Standalone:
+
+    python3 tools/sprite_pipeline.py [--check]
+"""
+import glob
+import os
+import re
+import struct
+import sys
+import zlib
+
+SPRITE_DIR = os.path.join("assets", "sprites")
+OUT_DIR = os.path.join("src", "sprites")
+PALETTE_HEADER = "sprite_palette.h"
+TRANSPARENT_KEY = 0xF81F  # Magenta in PNG sources means transparent
+
+# Clip slots in SpriteDefinition::clips, same order as SpriteClip in sprite.h
+CLIPS = ["idle", "walk_n", "walk_e", "walk_s", "walk_w", "bump", "celebrate"]
+
+COMPILE_MODES = {"draw", "tint"}
+
+
+class SpriteError(Exception):
+    pass
+
+
+# -----------------------------------------------------------------------------
+# Source parsing
+# -----------------------------------------------------------------------------
+
+class Sprite:
+    def __init__(self, path):
+        self.path = path
+        self.name = None
+        self.header = None
+        self.width = self.height = 0
+        self.palette = {}          # symbol -> RGB565 or None (transparent)
+        self.clips = {}            # clip name -> Clip
+        self.compile = set()       # "draw" and/or "tint": frames to emit as code
+        self.frames = []           # list of rows of RGB565/None, all clips
+        self.comments = []         # per-frame trailing comment
+
+
+class Clip:
+    def __init__(self, name, frame_ms, loop):
+        self.name = name
+        self.frame_ms = frame_ms
+        self.loop = loop
+        self.frames = []           # indices into Sprite.frames
+
+
+def rgb888_to_565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def read_png(path):
+    """Minimal PNG reader: 8-bit RGB/RGBA, non-interlaced. Returns (w, h, rows of RGBA tuples)."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise SpriteError("%s: not a PNG" % path)
+    pos, idat, ihdr = 8, b"", None
+    while pos < len(data):
+        length, tag = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if tag == b"IHDR":
+            ihdr = struct.unpack(">IIBBBBB", body)
+        elif tag == b"IDAT":
+            idat += body
+        pos += 12 + length
+    width, height, depth, ctype, _, _, interlace = ihdr
+    if depth != 8 or ctype not in (2, 6) or interlace:
+        raise SpriteError("%s: only 8-bit RGB/RGBA non-interlaced PNGs are supported" % path)
+    bpp = 3 if ctype == 2 else 4
+    raw = zlib.decompress(idat)
+    stride = width * bpp
+    rows, prev, i = [], bytearray(stride), 0
+    for _ in range(height):
+        ftype = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        rows.append([tuple(line[x * bpp:x * bpp + bpp]) + ((255,) if bpp == 3 else ())
+                     for x in range(width)])
+        prev = line
+    return width, height, rows
+
+
+def load_strip(sp, clip, image):
+    if sp.width == 0:
+        raise SpriteError("%s: 'size' must come before 'image'" % sp.path)
+    w, h, rows = read_png(image)
+    if h != sp.height or w % sp.width:
+        raise SpriteError("%s: image size %dx%d is not a strip of %dx%d frames"
+                          % (sp.path, w, h, sp.width, sp.height))
+    for fx in range(w // sp.width):
+        frame = []
+        for y in range(h):
+            row = []
+            for x in range(sp.width):
+                r, g, b, a = rows[y][fx * sp.width + x]
+                c = rgb888_to_565(r, g, b)
+                row.append(None if a < 128 or c == TRANSPARENT_KEY else c)
+            frame.append(row)
+        clip.frames.append(len(sp.frames))
+        sp.frames.append(frame)
+        sp.comments.append("%s frame %d" % (os.path.basename(image), fx))
+
+
+def parse_sprite(path):
+    sp = Sprite(path)
+    section = None
+    frame = None
+    clip = None
+
+    def current_clip(lineno):
+        if clip is None:
+            fail(lineno, "frames must follow an 'animation:' line")
+        return clip
+
+    def fail(lineno, msg):
+        raise SpriteError("%s:%d: %s" % (path, lineno, msg))
+
+    with open(path) as f:
+        lines = f.readlines()
+
+    for lineno, line in enumerate(lines, 1):
+        comment = ""
+        if "#" in line:
+            line, comment = line.split("#", 1)
+        text = line.strip()
+        if not text:
+            continue
+
+        key = re.match(r"^(\w+):\s*(.*)$", text)
+        if key and not line.startswith((" ", "\t")):
+            name, value = key.group(1), key.group(2).strip()
+            section = None
+            if name == "name":
+                sp.name = value
+            elif name == "header":
+                sp.header = value
+            elif name == "size":
+                m = re.match(r"^(\d+)x(\d+)$", value)
+                if not m:
+                    fail(lineno, "size must be WxH")
+                sp.width, sp.height = int(m.group(1)), int(m.group(2))
+            elif name == "palette":
+                section = "palette"
+            elif name == "animation":
+                parts = value.split()
+                if len(parts) not in (2, 3) or (len(parts) == 3 and parts[2] not in ("loop", "once")):
+                    fail(lineno, "animation: <clip> <frame_ms> [loop|once]")
+                if parts[0] not in CLIPS:
+                    fail(lineno, "unknown clip '%s' (expected one of %s)" % (parts[0], ", ".join(CLIPS)))
+                if parts[0] in sp.clips:
+                    fail(lineno, "clip '%s' defined twice" % parts[0])
+                loop = parts[2] == "loop" if len(parts) == 3 else parts[0] == "idle"
+                clip = Clip(parts[0], int(parts[1]), loop)
+                sp.clips[clip.name] = clip
+            elif name == "frame":
+                section = "frame"
+                frame = []
+                current_clip(lineno).frames.append(len(sp.frames))
+                sp.frames.append(frame)
+                sp.comments.append(comment.strip())
+            elif name == "compile":
+                modes = set(m.strip() for m in value.split(","))
+                if not modes or not modes <= COMPILE_MODES:
+                    fail(lineno, "compile: draw, tint or draw, tint")
+                sp.compile = modes
+            elif name == "image":
+                load_strip(sp, current_clip(lineno), os.path.join(os.path.dirname(path), value))
+            else:
+                fail(lineno, "unknown key '%s'" % name)
+            continue
+
+        if section == "palette":
+            m = re.match(r"^(\S)\s*=\s*(\w+)$", text)
+            if not m:
+                fail(lineno, "palette entry must be '<symbol> = RRRR|transparent'")
+            sym, val = m.group(1), m.group(2)
+            sp.palette[sym] = None if val == "transparent" else int(val, 16)
+        elif section == "frame":
+            row = []
+            for ch in text:
+                if ch not in sp.palette:
+                    fail(lineno, "symbol '%s' not in palette" % ch)
+                row.append(sp.palette[ch])
+            if len(row) != sp.width:
+                fail(lineno, "row is %d pixels, expected %d" % (len(row), sp.width))
+            frame.append(row)
+        else:
+            fail(lineno, "unexpected line")
+
+    if not sp.name or not sp.header:
+        raise SpriteError("%s: 'name' and 'header' are required" % path)
+    if "idle" not in sp.clips:
+        raise SpriteError("%s: an idle clip is required" % path)
+    for c in sp.clips.values():
+        if not c.frames:
+            raise SpriteError("%s: clip '%s' has no frames" % (path, c.name))
+    if sp.width > 8 or sp.height > 8:
+        raise SpriteError("%s: row masks are one byte per row, sprites can be at most 8x8" % path)
+    for i, fr in enumerate(sp.frames):
+        if len(fr) != sp.height:
+            raise SpriteError("%s: frame %d has %d rows, expected %d" % (path, i, len(fr), sp.height))
+    return sp
+
+
+# -----------------------------------------------------------------------------
+# Encoding
+# -----------------------------------------------------------------------------
+
+def row_mask(row):
+    """Opacity bitmask of one row, bit 7 = leftmost pixel."""
+    mask = 0
+    for x, c in enumerate(row):
+        if c is not None:
+            mask |= 0x80 >> x
+    return mask
+
+
+def pack_indices(indices, bpp):
+    """Pack indices LSB-first into bytes."""
+    out, acc, nbits = [], 0, 0
+    for idx in indices:
+        acc |= idx << nbits
+        nbits += bpp
+        if nbits >= 8:
+            out.append(acc & 0xFF)
+            acc >>= 8
+            nbits -= 8
+    if nbits:
+        out.append(acc & 0xFF)
+    return out
+
+
+def native_color(c):
+    """RGB565 -> framebuffer color, same math as GFXMatrix::LEDmx_565toRGB."""
+    r, g, b = c & 0xF800, c & 0x07E0, c & 0x001F
+    return (((r * r) >> 24) << 16) | (((g * g) >> 14) << 8) | ((b * b) >> 2)
+
+
+def thumb_bytes(rows, colors):
+    """Rough Cortex-M0+ size of a compiled frame: a 2-byte str per pixel, a
+    base-pointer bump per row, a literal load (+pool word) per color and
+    the call overhead. An estimate from the generated code, not the compiler's
+    output; the firmware map (or arm-none-eabi-nm --size-sort) has the real
+    sizes of the _DRAW/_FILL functions."""
+    stores = sum(len(r) for r in rows)
+    bumps = max(0, len([r for r in rows if r]) - 1)
+    return 2 * stores + 2 * bumps + 6 * colors + 4
+
+
+class EncodedSprite:
+    def __init__(self, sprite, shared_palette):
+        self.sprite = sprite
+        colors = []
+        for fr in sprite.frames:
+            for row in fr:
+                for c in row:
+                    if c is not None and c not in colors:
+                        colors.append(c)
+        if len(colors) > 16:
+            raise SpriteError("%s: %d opaque colors, at most 16 supported" % (sprite.path, len(colors)))
+        self.bpp = 2 if len(colors) <= 4 else 4
+        for c in colors:
+            if c not in shared_palette:
+                shared_palette.append(c)
+        self.local_colors = colors
+        # Padded to 1 << bpp entries so the renderer can load it blindly
+        self.palette_map = [shared_palette.index(c) for c in colors]
+        self.palette_map += [0] * ((1 << self.bpp) - len(colors))
+
+        self.frames = []  # (mask bytes, pixel bytes)
+        for fr in sprite.frames:
+            masks = [row_mask(row) for row in fr]
+            indices = [colors.index(c) for row in fr for c in row if c is not None]
+            self.frames.append((masks, pack_indices(indices, self.bpp) or [0]))
+
+        # Opaque pixels per row as (x, color) for compiled frames
+        self.opaque = [[[(x, c) for x, c in enumerate(row) if c is not None] for row in fr]
+                       for fr in sprite.frames]
+
+    def code_bytes(self):
+        """Estimated code size of all compiled functions for this sprite."""
+        total = 0
+        for rows in self.opaque:
+            if "draw" in self.sprite.compile:
+                total += thumb_bytes(rows, len(set(c for r in rows for _, c in r)))
+            if "tint" in self.sprite.compile:
+                total += thumb_bytes(rows, 0)
+        return total
+
+    def packed_bytes(self):
+        return len(self.palette_map) + sum(len(r) + len(p) for r, p in self.frames)
+
+    def raw_bytes(self):
+        return len(self.frames) * self.sprite.width * self.sprite.height * 2
+
+
+# -----------------------------------------------------------------------------
+# Header generation
+# -----------------------------------------------------------------------------
+
+def c_bytes(values, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join("0x%02X" % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def guard_for(header):
+    return re.sub(r"\W", "_", header).upper()
+
+
+def sources_comment(paths):
+    return ", ".join(os.path.relpath(p).replace(os.sep, "/") for p in paths)
+
+
+def render_palette(palette, sources):
+    out = []
+    out.append("// sprites/%s" % PALETTE_HEADER)
+    out.append("// Shared RGB565 sprite palette")
+    out.append("// GENERATED by tools/sprite_pipeline.py from %s - do not edit" % sources)
+    out.append("#ifndef %s" % guard_for(PALETTE_HEADER))
+    out.append("#define %s" % guard_for(PALETTE_HEADER))
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("#define SPRITE_PALETTE_SIZE %d" % len(palette))
+    out.append("")
+    out.append("const uint16_t PROGMEM SPRITE_PALETTE[SPRITE_PALETTE_SIZE] = {")
+    for i, c in enumerate(palette):
+        out.append("    0x%04X,  // %d" % (c, i))
+    out.append("};")
+    out.append("")
+    out.append("#endif // %s" % guard_for(PALETTE_HEADER))
+    return "\n".join(out) + "\n"
+
+
+def render_group(header, encoded):
+    out = []
+    out.append("// sprites/%s" % header)
+    out.append("// Packed indexed sprite data (see SpriteFrame in sprite.h for the layout)")
+    out.append("// GENERATED by tools/sprite_pipeline.py from %s - do not edit"
+               % sources_comment(e.sprite.path for e in encoded))
+    out.append("#ifndef %s" % guard_for(header))
+    out.append("#define %s" % guard_for(header))
+    out.append("")
+    out.append("#include <Arduino.h>")
+    if any(e.sprite.compile for e in encoded):
+        out.append('#include "../config.h"')
+    out.append('#include "sprite.h"')
+    for e in encoded:
+        sp = e.sprite
+        n = sp.name
+        out.append("")
+        out.append("// " + "=" * 77)
+        out.append("// %s: %dx%d, %d bpp, %d frame(s) in %d clip(s), %d bytes packed (%d as RGB565)"
+                   % (n, sp.width, sp.height, e.bpp, len(e.frames), len(sp.clips),
+                      e.packed_bytes(), e.raw_bytes()))
+        if sp.compile:
+            out.append("// Compiled (%s): ~%d bytes of code (estimated, not measured), run from RAM"
+                       % (", ".join(sorted(sp.compile)), e.code_bytes()))
+        out.append("// " + "=" * 77)
+        out.append("")
+        out.append("const uint8_t PROGMEM %s_PALETTE_MAP[] = { %s };"
+                   % (n, ", ".join(str(i) for i in e.palette_map)))
+        for fi, (masks, pixels) in enumerate(e.frames):
+            note = sp.comments[fi]
+            out.append("")
+            if note:
+                out.append("// Frame %d - %s" % (fi, note))
+            out.append("const uint8_t PROGMEM %s_F%d_MASK[] = {" % (n, fi))
+            out.append(c_bytes(masks))
+            out.append("};")
+            out.append("const uint8_t PROGMEM %s_F%d_PIXELS[] = {" % (n, fi))
+            out.append(c_bytes(pixels))
+            out.append("};")
+            for mode in ("draw", "tint"):
+                if mode in sp.compile:
+                    out.extend(render_compiled("%s_F%d" % (n, fi), e.opaque[fi], mode))
+        for name in CLIPS:
+            clip = sp.clips.get(name)
+            if clip is None:
+                continue
+            out.append("")
+            out.append("const SpriteFrame PROGMEM %s_%s_FRAMES[] = {" % (n, name.upper()))
+            for fi in clip.frames:
+                draw = ("%s_F%d_DRAW" % (n, fi)) if "draw" in sp.compile else "nullptr"
+                fill = ("%s_F%d_FILL" % (n, fi)) if "tint" in sp.compile else "nullptr"
+                out.append("    { %s_F%d_MASK, %s_F%d_PIXELS, %s, %s },"
+                           % (n, fi, n, fi, draw, fill))
+            out.append("};")
+        out.append("")
+        out.append("const SpriteDefinition %s_SPRITE PROGMEM = {" % n)
+        out.append("    .width = %d," % sp.width)
+        out.append("    .height = %d," % sp.height)
+        out.append("    .bpp = %d," % e.bpp)
+        out.append("    .palette_map = %s_PALETTE_MAP," % n)
+        out.append("    .clips = {")
+        for name in CLIPS:
+            clip = sp.clips.get(name)
+            if clip is None:
+                out.append("        { nullptr, 0, 0, 0 },  // %s (none)" % name)
+            else:
+                out.append("        { %s_%s_FRAMES, %d, %d, %s },  // %s"
+                           % (n, name.upper(), len(clip.frames), clip.frame_ms,
+                              "ANIM_LOOP" if clip.loop else "ANIM_ONCE", name))
+        out.append("    }")
+        out.append("};")
+    out.append("")
+    out.append("#endif // %s" % guard_for(header))
+    return "\n".join(out) + "\n"
+
+
+def render_compiled(name, rows, mode):
+    """Straight-line function for one frame: every opaque pixel is one store at
+    a constant offset from dst (the sprite's top-left pixel in the framebuffer)."""
+    out = [""]
+    if mode == "draw":
+        out.append("static void __not_in_flash_func(%s_DRAW)(uint32_t* dst) {" % name)
+        colors = []
+        for r in rows:
+            for _, c in r:
+                if c not in colors:
+                    colors.append(c)
+        for i, c in enumerate(colors):
+            out.append("    const uint32_t c%d = 0x%06X;  // %04X" % (i, native_color(c), c))
+        value = lambda c: "c%d" % colors.index(c)
+    else:
+        out.append("static void __not_in_flash_func(%s_FILL)(uint32_t* dst, uint32_t color) {" % name)
+        value = lambda c: "color"
+
+    at = 0  # Row dst currently points at
+    for y, r in enumerate(rows):
+        if not r:
+            continue
+        if y > at:
+            out.append("    dst += %sMATRIX_WIDTH;" % ("" if y - at == 1 else "%d * " % (y - at)))
+            at = y
+        out.append("    " + " ".join("dst[%d] = %s;" % (x, value(c)) for x, c in r))
+    out.append("}")
+    return out
+
+
+def write_if_changed(path, text, check):
+    old = None
+    if os.path.exists(path):
+        with open(path) as f:
+            old = f.read()
+    if old == text:
+        return False
+    if check:
+        raise SpriteError("%s is out of date - run tools/sprite_pipeline.py" % path)
+    with open(path, "w") as f:
+        f.write(text)
+    return True
+
+
+def run(project_dir, check=False, verbose=True):
+    cwd = os.getcwd()
+    os.chdir(project_dir)
+    try:
+        paths = sorted(glob.glob(os.path.join(SPRITE_DIR, "*.sprite")))
+        if not paths:
+            return
+        sprites = [parse_sprite(p) for p in paths]
+
+        palette = []
+        groups = {}
+        for sp in sprites:
+            groups.setdefault(sp.header, []).append(EncodedSprite(sp, palette))
+        if len(palette) > 256:
+            raise SpriteError("shared palette has %d colors, at most 256 supported" % len(palette))
+
+        changed = []
+        text = render_palette(palette, sources_comment(paths))
+        if write_if_changed(os.path.join(OUT_DIR, PALETTE_HEADER), text, check):
+            changed.append(PALETTE_HEADER)
+        for header, encoded in sorted(groups.items()):
+            if write_if_changed(os.path.join(OUT_DIR, header), render_group(header, encoded), check):
+                changed.append(header)
+
+        if verbose:
+            packed = sum(e.packed_bytes() for g in groups.values() for e in g) + len(palette) * 2
+            raw = sum(e.raw_bytes() for g in groups.values() for e in g)
+            print("[sprites] %d sprite(s), %d palette colors: %d bytes packed vs %d RGB565 (%.1fx)%s"
+                  % (len(sprites), len(palette), packed, raw, raw / float(packed),
+                     (", updated " + ", ".join(changed)) if changed else ""))
+            for e in (e for g in groups.values() for e in g):
+                print("[sprites]   %-10s %4d bytes data%s"
+                      % (e.sprite.name, e.packed_bytes(),
+                         (", ~%d bytes compiled (%s, estimated)" % (e.code_bytes(), ", ".join(sorted(e.sprite.compile))))
+                         if e.sprite.compile else ""))
+    finally:
+        os.chdir(cwd)
+
+
+try:
+    # Running as a PlatformIO extra script (SCons provides Import/env)
+    Import("env")  # noqa: F821
+    run(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        try:
+            run(os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir),
+                check="--check" in sys.argv[1:])
+        except SpriteError as e:
+            sys.exit("sprite_pipeline: %s" % e)